@@ -0,0 +1,172 @@
+// Host-side render benchmark for the watch screens.
+//
+// Builds LVGL 9 with the real screen code (ui_*.cpp, uiWeatherScreen.cpp,
+// clock.cpp) and stubbed managers, renders into an in-memory 466x466 RGB565
+// frame, and reports per screen:
+//   - a forced full redraw
+//   - a typical 1 Hz tick (clock values advanced by one second)
+//
+//   pio run -e native_bench
+//   .pio/build/native_bench/program [iterations]
+//
+// Uses the same DIRECT render mode and even/odd rounder as the firmware, so
+// the pixel counts match what would go to the panel (minus the round mask).
+// "A:" images come from the staged .pio/assets/native_bench/data (LVGL's POSIX
+// driver, see lv_conf.h), so run it from the project dir.
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ui.h"
+#include "ui_MainScreen.h"
+#include "uiWeatherScreen.h"
+#include "ui_Settings.h"
+#include "ui_Power.h"
+#include "ScreenCache.h"
+#include "clock.h"
+
+#define BENCH_W 466
+#define BENCH_H 466
+
+static uint16_t s_frame[BENCH_W * BENCH_H];
+static uint64_t s_pixels = 0;
+static uint32_t s_areas = 0;
+
+static double now_ms()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t tick_cb(void)
+{
+    return millis();
+}
+
+static void bench_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+{
+    (void)px_map;
+    s_pixels += (uint64_t)lv_area_get_width(area) * lv_area_get_height(area);
+    s_areas++;
+    lv_display_flush_ready(disp);
+}
+
+// Same alignment the CO5300 needs (see rounder_event_cb in main.cpp)
+static void bench_rounder(lv_event_t* e)
+{
+    lv_area_t* area = (lv_area_t*)lv_event_get_param(e);
+    if (!area) return;
+    area->x1 &= ~1;
+    area->x2 |= 1;
+    area->y1 &= ~1;
+    area->y2 |= 1;
+}
+
+// Whatever the firmware does once a second while this screen is showing
+static void tick_clock_values()
+{
+    second_value = (second_value + 1) % 60;
+    if (second_value == 0) minute_value = (minute_value + 1) % 60;
+    if (second_value == 0 && minute_value == 0) hour_value = (hour_value + 1) % 12;
+}
+
+static void tick_main()    { tick_clock_values(); update_main_screen(); }
+static void tick_clock()   { tick_clock_values(); update_clock_screen(); }
+static void tick_weather() { ui_WeatherScreen_tick(); }
+static void tick_none()    {}
+
+struct ScreenBench {
+    const char* name;
+    lv_obj_t**  screen;
+    void (*tick)();
+};
+
+static void run_screen(lv_display_t* disp, const ScreenBench& b, int iterations)
+{
+    lv_obj_t* scr = *b.screen;
+    if (!scr) {
+        printf("%-9s  (not created)\n", b.name);
+        return;
+    }
+
+    lv_screen_load(scr);
+    lv_refr_now(disp);   // warm-up
+
+    // Full redraws
+    double fullTotal = 0, fullMin = 1e9;
+    uint64_t fullPx = 0;
+    for (int i = 0; i < iterations; i++) {
+        s_pixels = 0;
+        lv_obj_invalidate(scr);
+        const double t0 = now_ms();
+        lv_refr_now(disp);
+        const double dt = now_ms() - t0;
+        fullTotal += dt;
+        if (dt < fullMin) fullMin = dt;
+        fullPx = s_pixels;
+    }
+
+    // 1 Hz ticks
+    double tickTotal = 0, tickMax = 0;
+    uint64_t tickPx = 0;
+    uint32_t tickAreas = 0;
+    for (int i = 0; i < iterations; i++) {
+        s_pixels = 0;
+        s_areas = 0;
+        const double t0 = now_ms();
+        b.tick();
+        lv_refr_now(disp);
+        const double dt = now_ms() - t0;
+        tickTotal += dt;
+        if (dt > tickMax) tickMax = dt;
+        tickPx += s_pixels;
+        tickAreas += s_areas;
+    }
+
+    printf("%-9s  full %7.2f ms (min %7.2f) %7llu px | tick %7.2f ms (max %7.2f) %7llu px %5.1f areas\n",
+           b.name,
+           fullTotal / iterations, fullMin, (unsigned long long)fullPx,
+           tickTotal / iterations, tickMax,
+           (unsigned long long)(tickPx / iterations),
+           (double)tickAreas / iterations);
+}
+
+int main(int argc, char** argv)
+{
+    const int iterations = (argc > 1 && atoi(argv[1]) > 0) ? atoi(argv[1]) : 50;
+
+    lv_init();
+    lv_tick_set_cb(tick_cb);
+
+    lv_display_t* disp = lv_display_create(BENCH_W, BENCH_H);
+    lv_display_set_flush_cb(disp, bench_flush);
+    lv_display_set_buffers(disp, s_frame, NULL, sizeof(s_frame), LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_add_event_cb(disp, bench_rounder, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    // Same bring-up as the firmware, then build the screens it leaves for
+    // first visit (nothing is evicted here; screen_cache_tick never runs)
+    ui_init();
+    screen_cache_ensure(&ui_WeatherScreen, ui_WeatherScreen_screen_init);
+    screen_cache_ensure(&ui_Settings, ui_Settings_screen_init);
+
+    const ScreenBench screens[] = {
+        { "Main",     &ui_MainScreen,    tick_main    },
+        { "Clock",    &ui_ClockScreen,   tick_clock   },
+        { "Weather",  &ui_WeatherScreen, tick_weather },
+        { "Settings", &ui_Settings,      tick_none    },
+        { "Power",    &ui_Power,         tick_none    },
+    };
+
+    printf("LVGL %d.%d.%d, %d draw unit(s), %d iterations\n",
+           lv_version_major(), lv_version_minor(), lv_version_patch(),
+           (int)LV_DRAW_SW_DRAW_UNIT_CNT, iterations);
+
+    for (const ScreenBench& b : screens) {
+        run_screen(disp, b, iterations);
+    }
+
+    return 0;
+}
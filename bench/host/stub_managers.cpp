@@ -0,0 +1,99 @@
+// Stand-ins for everything the screen code calls outside LVGL.
+// They return fixed, plausible data so every screen draws its normal content
+// (weather label, tide ring, ...) without any hardware or network.
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Wire.h>
+#include <chrono>
+#include <thread>
+
+#include "WeatherManager.h"
+#include "SettingsManager.h"
+#include "PowerManager.h"
+#include "DisplayManager.h"
+
+HostSerial Serial;
+TwoWire    Wire;
+WiFiClass  WiFi;
+
+static const auto g_start = std::chrono::steady_clock::now();
+
+uint32_t millis()
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - g_start).count();
+}
+
+uint32_t micros()
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - g_start).count();
+}
+
+void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ---------------- WeatherManager ----------------
+
+WeatherData currentWeatherData = {
+    12.5f, 4.1f, 0.0f, 1700000000u, 1700038000u,
+    0, 0, 803, 71, "broken clouds", "04d"
+};
+
+const WeatherData& WeatherGet()
+{
+    return currentWeatherData;
+}
+
+bool WeatherManager_GetTideCurve(float* heights, uint16_t maxSamples, uint16_t& outCount,
+                                 time_t& outFirstSampleUtc, uint32_t& outStepSeconds)
+{
+    // Two tides a day, 48 h of half-hour samples
+    const uint16_t n = maxSamples < 96 ? maxSamples : 96;
+    for (uint16_t i = 0; i < n; i++) {
+        heights[i] = 1.8f + 1.4f * sinf((float)i * 2.0f * (float)M_PI / 24.8f);
+    }
+    outCount = n;
+    outFirstSampleUtc = time(nullptr) - 6 * 3600;
+    outStepSeconds = 1800;
+    return true;
+}
+
+void WeatherManager_MarkTideCurveDirty() {}
+bool WeatherManager_TakeTideCurveDirtyFlag() { return false; }
+
+// ---------------- SettingsManager ----------------
+
+SettingsData currentSettings = {
+    "", "", 0, 80, 30, 60, 50, "0", "0", {}
+};
+
+bool loadSettingsDataFromFile(const char*, SettingsData&) { return false; }
+void saveSettingsDataToFile(const char*, const SettingsData&) {}
+void initializeSettingsData() {}
+
+// ---------------- PowerManager ----------------
+
+PowerManager& PowerManager::instance()
+{
+    static PowerManager inst;
+    return inst;
+}
+
+PowerManager::PowerState PowerManager::state() const { return st_; }
+void PowerManager::restart() {}
+void PowerManager::shutdown() {}
+
+// ---------------- DisplayManager ----------------
+
+DisplayManager& DisplayManager::instance()
+{
+    static DisplayManager inst;
+    return inst;
+}
+
+void DisplayManager::setBrightness(uint8_t value) { brightness_ = value; }
+uint8_t DisplayManager::getBrightness() const { return brightness_; }
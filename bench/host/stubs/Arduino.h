@@ -0,0 +1,110 @@
+// Minimal Arduino surface for the host render benchmark.
+// Only what the screen code and the manager headers actually touch.
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+#include <algorithm>
+
+#define IRAM_ATTR
+#define PROGMEM
+#define F(s) (s)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+class String
+{
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    String(int v) : s_(std::to_string(v)) {}
+    String(unsigned int v) : s_(std::to_string(v)) {}
+    String(long v) : s_(std::to_string(v)) {}
+    String(unsigned long v) : s_(std::to_string(v)) {}
+    String(double v, unsigned char decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        s_ = buf;
+    }
+
+    const char* c_str() const { return s_.c_str(); }
+    unsigned int length() const { return (unsigned int)s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+    int indexOf(char c) const { size_t p = s_.find(c); return p == std::string::npos ? -1 : (int)p; }
+    int indexOf(const char* s) const { size_t p = s_.find(s); return p == std::string::npos ? -1 : (int)p; }
+    String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from >= s_.size() || to <= from) return String();
+        return String(s_.substr(from, to - from));
+    }
+    bool startsWith(const char* p) const { return s_.compare(0, strlen(p), p) == 0; }
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+    double toDouble() const { return strtod(s_.c_str(), nullptr); }
+
+    String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    String& operator+=(const char* o) { s_ += o; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b.s_); }
+
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+    bool operator!=(const String& o) const { return s_ != o.s_; }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    bool operator<(const String& o) const { return s_ < o.s_; }
+    bool operator>(const String& o) const { return s_ > o.s_; }
+
+private:
+    std::string s_;
+};
+
+class HostSerial
+{
+public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+
+    void print(const char* s) { fputs(s, stdout); }
+    void print(const String& s) { fputs(s.c_str(), stdout); }
+    void print(long v) { printf("%ld", v); }
+    void print(double v) { printf("%.2f", v); }
+
+    void println() { fputc('\n', stdout); }
+    template <typename T> void println(const T& v) { print(v); println(); }
+
+    int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list ap;
+        va_start(ap, fmt);
+        const int n = vprintf(fmt, ap);
+        va_end(ap);
+        return n;
+    }
+};
+
+extern HostSerial Serial;
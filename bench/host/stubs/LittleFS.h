@@ -0,0 +1,2 @@
+// Host benchmark stub: not used by the screen code
+#pragma once
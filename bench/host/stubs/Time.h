@@ -0,0 +1,3 @@
+// Host benchmark stub. Also keeps <time.h> working on case-insensitive filesystems.
+#pragma once
+#include_next <time.h>
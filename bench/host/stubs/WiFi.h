@@ -0,0 +1,25 @@
+// Host benchmark stub: no radio, scans find nothing.
+#pragma once
+#include <Arduino.h>
+
+enum wifi_mode_t { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA };
+enum wifi_auth_mode_t { WIFI_AUTH_OPEN = 0, WIFI_AUTH_WPA2_PSK = 3 };
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 };
+
+class WiFiClass
+{
+public:
+    bool mode(wifi_mode_t) { return true; }
+    bool setSleep(bool) { return true; }
+    wl_status_t begin(const char*, const char* = nullptr) { return WL_DISCONNECTED; }
+    bool disconnect(bool = false, bool = false) { return true; }
+    wl_status_t status() { return WL_DISCONNECTED; }
+    int16_t scanNetworks() { return 0; }
+    int16_t scanComplete() { return 0; }
+    void scanDelete() {}
+    String SSID(uint8_t = 0) { return String(); }
+    int32_t RSSI(uint8_t = 0) { return -127; }
+    wifi_auth_mode_t encryptionType(uint8_t = 0) { return WIFI_AUTH_OPEN; }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,11 @@
+// Host benchmark stub
+#pragma once
+#include <Arduino.h>
+
+class TwoWire
+{
+public:
+    bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,20 @@
+// Host benchmark stub: every capability is plain malloc
+#pragma once
+#include <stdlib.h>
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+static inline void* heap_caps_malloc(size_t size, unsigned) { return malloc(size); }
+static inline void* heap_caps_calloc(size_t n, size_t size, unsigned) { return calloc(n, size); }
+static inline void* heap_caps_realloc(void* p, size_t size, unsigned) { return realloc(p, size); }
+static inline void  heap_caps_free(void* p) { free(p); }
+// Report a roomy heap: 0 would make LvglHeap push everything to the PSRAM
+// tier and ScreenCache see permanent memory pressure
+static inline size_t heap_caps_get_free_size(unsigned) { return 8u * 1024 * 1024; }
+static inline size_t heap_caps_get_largest_free_block(unsigned) { return 4u * 1024 * 1024; }
+static inline bool  heap_caps_check_integrity_all(bool) { return true; }
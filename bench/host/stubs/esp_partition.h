@@ -0,0 +1,25 @@
+// Host benchmark stub: there is no flash, so no partition is ever found
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+typedef enum { ESP_PARTITION_TYPE_APP = 0x00, ESP_PARTITION_TYPE_DATA = 0x01 } esp_partition_type_t;
+typedef int esp_partition_subtype_t;
+typedef enum { ESP_PARTITION_MMAP_DATA, ESP_PARTITION_MMAP_INST } esp_partition_mmap_memory_t;
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef struct {
+    uint32_t address;
+    uint32_t size;
+} esp_partition_t;
+
+static inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t, const char*) { return NULL; }
+static inline esp_err_t esp_partition_read(const esp_partition_t*, size_t, void*, size_t) { return -1; }
+static inline esp_err_t esp_partition_mmap(const esp_partition_t*, size_t, size_t, esp_partition_mmap_memory_t,
+                                           const void**, esp_partition_mmap_handle_t*) { return -1; }
+static inline void esp_partition_munmap(esp_partition_mmap_handle_t) {}
@@ -0,0 +1,3 @@
+// WeatherManager.h includes "tide.h"; the file is Tide.h (case-sensitive host)
+#pragma once
+#include "Tide.h"
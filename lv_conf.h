@@ -40,7 +40,7 @@
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
-#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM   /* tiered internal/PSRAM allocator in src/LvglHeap.cpp */
 
 /** Possible values
  * - LV_STDLIB_BUILTIN:     LVGL's built in implementation
@@ -107,7 +107,12 @@
  * - LV_OS_MQX
  * - LV_OS_SDL2
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+#ifdef SMARTWATCH_HOST_BENCH
+    /* Host render benchmark (env:native_bench): same draw units, pthreads */
+    #define LV_USE_OS   LV_OS_PTHREAD
+#else
+    #define LV_USE_OS   LV_OS_FREERTOS
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -117,8 +122,11 @@
      * Unblocking an RTOS task with a direct notification is 45% faster and uses less RAM
      * than unblocking a task using an intermediary object such as a binary semaphore.
      * RTOS task notifications can only be used when there is only one task that can be the recipient of the event.
+     *
+     * Kept off: main.cpp's lvgl task already sleeps on its own task notification
+     * (lvgl_wake), and the two would steal each other's wakeups.
      */
-    #define LV_USE_FREERTOS_TASK_NOTIFY 1
+    #define LV_USE_FREERTOS_TASK_NOTIFY 0
 #endif
 
 /*========================
@@ -192,7 +200,7 @@
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    2
 
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -497,11 +505,11 @@
  *  If size is not set to 0, the decoder will fail to decode when the cache is full.
  *  If size is 0, the cache function is not enabled and the decoded memory will be
  *  released immediately after use. */
-#define LV_CACHE_DEF_SIZE       0
+#define LV_CACHE_DEF_SIZE       0   /* decoded .bin assets are cached in PSRAM by src/ImageCache instead */
 
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
-#define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
+#define LV_IMAGE_HEADER_CACHE_DEF_CNT 32   /* covers every asset, so file-path fallbacks skip re-reading headers */
 
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
@@ -623,7 +631,7 @@
 #define LV_FONT_MONTSERRAT_42 0
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
-#define LV_FONT_MONTSERRAT_48 0
+#define LV_FONT_MONTSERRAT_48 1    /* uiWeatherScreen temperature */
 
 /* Demonstrate special features */
 #define LV_FONT_MONTSERRAT_28_COMPRESSED    0  /**< bpp = 3 */
@@ -870,10 +878,16 @@
 #endif
 
 /** API for open, read, etc. */
-#define LV_USE_FS_POSIX 0
+/* Host bench only: "A:/lvgl/..." reads the copy lvgl_assets.py staged for the
+ * native_bench env, so run the program from the project dir. */
+#ifdef SMARTWATCH_HOST_BENCH
+    #define LV_USE_FS_POSIX 1
+#else
+    #define LV_USE_FS_POSIX 0
+#endif
 #if LV_USE_FS_POSIX
-    #define LV_FS_POSIX_LETTER '\0'     /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
-    #define LV_FS_POSIX_PATH ""         /**< Set the working directory. File/directory paths will be appended to it. */
+    #define LV_FS_POSIX_LETTER 'A'      /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
+    #define LV_FS_POSIX_PATH ".pio/assets/native_bench/data" /**< Set the working directory. File/directory paths will be appended to it. */
     #define LV_FS_POSIX_CACHE_SIZE 0    /**< >0 to cache this number of bytes in lv_fs_read() */
 #endif
 
@@ -907,9 +921,16 @@
 #endif
 
 /** API for Arduino LittleFs. */
-#define LV_USE_FS_ARDUINO_ESP_LITTLEFS 0
+/* "A:/lvgl/..." images are pre-converted .bin files (scripts/lvgl_assets.py) read
+ * straight off LittleFS by the built-in bin decoder. The host bench uses the
+ * POSIX driver above instead. */
+#ifdef SMARTWATCH_HOST_BENCH
+    #define LV_USE_FS_ARDUINO_ESP_LITTLEFS 0
+#else
+    #define LV_USE_FS_ARDUINO_ESP_LITTLEFS 1
+#endif
 #if LV_USE_FS_ARDUINO_ESP_LITTLEFS
-    #define LV_FS_ARDUINO_ESP_LITTLEFS_LETTER '\0'  /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
+    #define LV_FS_ARDUINO_ESP_LITTLEFS_LETTER 'A'  /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
     #define LV_FS_ARDUINO_ESP_LITTLEFS_PATH ""      /**< Set the working directory. File/directory paths will be appended to it. */
 #endif
 
@@ -1038,7 +1059,7 @@
 /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/details/auxiliary-modules/index.html . */
 
 /** 1: Enable API to take snapshot for object */
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /** 1: Enable system monitor component */
 #define LV_USE_SYSMON   0
@@ -0,0 +1,338 @@
+# PlatformIO pre-script: converts the PNG/JPG assets in data/ into LVGL v9 .bin
+# images so the firmware never needs a PNG/JPEG decoder.
+#
+# data/ stays the source of truth. A converted copy is staged under
+# .pio/assets/<env>/data and PROJECT_DATA_DIR is pointed at it, so
+# "pio run -t buildfs / uploadfs" packs the .bin files instead of the originals.
+# Files that don't match a rule (sounds, unused art) are copied as they are.
+#
+# Images are pre-scaled to the size they're shown at, so LVGL never has to
+# zoom them at draw time either.
+#
+# It also writes AssetManifest.h (an AssetId enum + path table) into the build
+# include path, so firmware names assets by ID and a missing file is a
+# compile error instead of a failed open at runtime.
+#
+# The staged lvgl/ tree is also packed into one blob for the "assets" flash
+# partition (see partitions_custom.csv and src/AssetPack.h), which the firmware
+# memory-maps so images are drawn straight out of flash. It's added to
+# FLASH_EXTRA_IMAGES, so a normal "pio run -t upload" writes it.
+
+Import("env")
+
+import fnmatch
+import os
+import shutil
+import struct
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    env.Execute("$PYTHONEXE -m pip install pillow")
+    from PIL import Image
+
+# (path glob relative to data/, display size or None to keep, colour format)
+ASSET_RULES = [
+    ("lvgl/weather/*.jpg",      (350, 350), "RGB565"),    # Weather screen s_bg (BG_SZ)
+    ("lvgl/img/bell_icon.png",  (19, 19),   "RGB565A8"),  # 32px bell drawn at zoom 150/256
+]
+
+# Asset pack layout, little endian. Must match src/AssetPack.cpp.
+#   header: u32 magic, u16 version, u16 count, u32 total size
+#   count x entry: char path[48] ("/lvgl/..."), u32 offset, u32 size
+#   file data, each 4-byte aligned (so pixels after a 12-byte image header are too)
+PACK_MAGIC = 0x4B505753  # "SWPK"
+PACK_VERSION = 1
+PACK_PATH_LEN = 48
+PACK_PARTITION = "assets"
+
+# Atlases: several same-size images stacked top to bottom in one .bin, shown
+# a cell at a time with lv_image_set_offset_y(). The cell order is the index
+# the firmware uses, so keep it in step with the enum named alongside.
+ATLASES = [
+    # WeatherIcon in src/WeatherIcons.h; ui_WeatherImage on Main (32x32)
+    ("lvgl/icons/atlas.bin", "lvgl/icons", (32, 32), "RGB565A8", [
+        "clear-day", "clear-night", "cloudy", "drizzle", "fog", "light-rain",
+        "partly-cloudy-day", "partly-cloudy-night", "rain", "sleet", "snow",
+        "thunderstorm", "unknown",
+    ]),
+]
+
+LV_IMAGE_HEADER_MAGIC = 0x19
+LV_COLOR_FORMAT = {
+    "RGB565":   0x12,
+    "RGB565A8": 0x14,
+}
+
+
+def rgb565(r, g, b):
+    r5 = (r * 31 + 127) // 255
+    g6 = (g * 63 + 127) // 255
+    b5 = (b * 31 + 127) // 255
+    return (r5 << 11) | (g6 << 5) | b5
+
+
+def encode_bin(img, cf_name):
+    w, h = img.size
+    stride = w * 2
+    header = struct.pack("<BBHHHHH", LV_IMAGE_HEADER_MAGIC, LV_COLOR_FORMAT[cf_name], 0, w, h, stride, 0)
+
+    if cf_name == "RGB565":
+        px = img.convert("RGB").tobytes()
+        out = bytearray(w * h * 2)
+        for i in range(w * h):
+            struct.pack_into("<H", out, i * 2, rgb565(px[i * 3], px[i * 3 + 1], px[i * 3 + 2]))
+        return header + bytes(out)
+
+    # RGB565A8: RGB565 plane, then an 8-bit alpha plane
+    px = img.convert("RGBA").tobytes()
+    rgb = bytearray(w * h * 2)
+    alpha = bytearray(w * h)
+    for i in range(w * h):
+        r, g, b, a = px[i * 4], px[i * 4 + 1], px[i * 4 + 2], px[i * 4 + 3]
+        struct.pack_into("<H", rgb, i * 2, rgb565(r, g, b) if a else 0)
+        alpha[i] = a
+    return header + bytes(rgb) + bytes(alpha)
+
+
+def match_rule(rel_path):
+    for pattern, size, cf_name in ASSET_RULES:
+        if fnmatch.fnmatch(rel_path, pattern):
+            return size, cf_name
+    return None
+
+
+# SCons runs this without __file__, so find ourselves through the project dir
+SCRIPT_PATH = os.path.join(env.subst("$PROJECT_DIR"), "scripts", "lvgl_assets.py")
+
+
+def up_to_date(src, dst):
+    # Re-convert when the rules above change too
+    return os.path.exists(dst) and os.path.getmtime(dst) >= max(os.path.getmtime(src), os.path.getmtime(SCRIPT_PATH))
+
+
+def convert(src, dst, size, cf_name):
+    img = Image.open(src)
+    img = img.convert("RGBA" if cf_name == "RGB565A8" else "RGB")
+    if size and img.size != size:
+        img = img.resize(size, Image.LANCZOS)
+    with open(dst, "wb") as f:
+        f.write(encode_bin(img, cf_name))
+
+
+def build_atlas(srcs, dst, cell, cf_name):
+    w, h = cell
+    mode = "RGBA" if cf_name == "RGB565A8" else "RGB"
+    sheet = Image.new(mode, (w, h * len(srcs)))
+    for i, src in enumerate(srcs):
+        img = Image.open(src).convert(mode)
+        if img.size != cell:
+            img = img.resize(cell, Image.LANCZOS)
+        sheet.paste(img, (0, i * h))
+    with open(dst, "wb") as f:
+        f.write(encode_bin(sheet, cf_name))
+
+
+def stage_atlases(src_root, out_root, wanted):
+    built = 0
+    consumed = set()
+    for out_rel, src_dir, cell, cf_name, names in ATLASES:
+        srcs = []
+        for name in names:
+            rel = "%s/%s.png" % (src_dir, name)
+            src = os.path.join(src_root, rel)
+            if not os.path.isfile(src):
+                sys.stderr.write("[assets] atlas %s is missing %s\n" % (out_rel, rel))
+                env.Exit(1)
+            srcs.append(src)
+            consumed.add(rel)
+
+        wanted.add(out_rel)
+        dst = os.path.join(out_root, out_rel)
+        if all(up_to_date(src, dst) for src in srcs):
+            continue
+        os.makedirs(os.path.dirname(dst), exist_ok=True)
+        build_atlas(srcs, dst, cell, cf_name)
+        built += 1
+    return built, consumed
+
+
+def stage_assets():
+    src_root = os.path.join(env.subst("$PROJECT_DIR"), "data")
+    out_root = os.path.join(env.subst("$PROJECT_DIR"), ".pio", "assets", env.subst("$PIOENV"), "data")
+    if not os.path.isdir(src_root):
+        return None
+
+    wanted = set()
+    converted, consumed = stage_atlases(src_root, out_root, wanted)
+
+    entries = []
+    for dirpath, _, files in os.walk(src_root):
+        for name in files:
+            src = os.path.join(dirpath, name)
+            rel = os.path.relpath(src, src_root).replace(os.sep, "/")
+            if rel in consumed:
+                continue  # only shipped inside its atlas
+            entries.append((src, rel, match_rule(rel)))
+    # Conversions first, so a converted .bin wins over a hand-made one of the same name
+    entries.sort(key=lambda e: e[2] is None)
+
+    for src, rel, rule in entries:
+        out_rel = os.path.splitext(rel)[0] + ".bin" if rule else rel
+        if out_rel in wanted:
+            continue
+        wanted.add(out_rel)
+
+        dst = os.path.join(out_root, out_rel)
+        if up_to_date(src, dst):
+            continue
+        os.makedirs(os.path.dirname(dst), exist_ok=True)
+        if rule:
+            convert(src, dst, rule[0], rule[1])
+            converted += 1
+        else:
+            shutil.copy2(src, dst)
+
+    # Drop outputs whose source went away
+    for dirpath, _, files in os.walk(out_root):
+        for name in files:
+            rel = os.path.relpath(os.path.join(dirpath, name), out_root).replace(os.sep, "/")
+            if rel not in wanted:
+                os.remove(os.path.join(dirpath, name))
+
+    if converted:
+        print("[assets] converted %d image(s) into %s" % (converted, out_root))
+    env.Replace(PROJECT_DATA_DIR=out_root)
+    return out_root
+
+
+def staged_files(staged_root):
+    """(rel "/lvgl/...", full path) for everything the firmware can ask for, sorted."""
+    files = []
+    for dirpath, _, names in os.walk(os.path.join(staged_root, "lvgl")):
+        for name in names:
+            full = os.path.join(dirpath, name)
+            rel = "/" + os.path.relpath(full, staged_root).replace(os.sep, "/")
+            if rel.endswith(".png") or rel.endswith(".jpg"):
+                continue  # unconverted sources; the firmware only asks for .bin
+            files.append((rel, full))
+    files.sort()
+    return files
+
+
+def asset_enum_name(rel):
+    # "/lvgl/weather/clear-day-bg.bin" -> ASSET_WEATHER_CLEAR_DAY_BG,
+    # "/lvgl/snd/tick.mp3" -> ASSET_SND_TICK_MP3
+    name = rel[len("/lvgl/"):]
+    if name.endswith(".bin"):
+        name = name[:-4]
+    return "ASSET_" + "".join(c if c.isalnum() else "_" for c in name).upper()
+
+
+def write_manifest(staged_root):
+    inc_dir = os.path.join(os.path.dirname(staged_root), "include")
+    files = staged_files(staged_root)
+
+    lines = [
+        "// Generated by scripts/lvgl_assets.py from data/ - do not edit.",
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+        "enum AssetId : uint16_t {",
+    ]
+    lines += ["  %s," % asset_enum_name(rel) for rel, _ in files]
+    lines += [
+        "  ASSET_COUNT",
+        "};",
+        "",
+        "// LVGL paths (\"A:\" is the LittleFS drive in lv_conf.h), indexed by AssetId",
+        "static constexpr const char* const kAssetPaths[ASSET_COUNT] = {",
+    ]
+    lines += ["  \"A:%s\"," % rel for rel, _ in files]
+    lines += [
+        "};",
+        "",
+        "constexpr const char* asset_path(AssetId id) { return kAssetPaths[id]; }",
+        "",
+    ]
+    text = "\n".join(lines)
+
+    path = os.path.join(inc_dir, "AssetManifest.h")
+    old = None
+    if os.path.exists(path):
+        with open(path) as f:
+            old = f.read()
+    if old != text:
+        os.makedirs(inc_dir, exist_ok=True)
+        with open(path, "w") as f:
+            f.write(text)
+        print("[assets] wrote %s (%d assets)" % (path, len(files)))
+    env.Append(CPPPATH=[inc_dir])
+
+
+def partition_offset(name):
+    csv_name = env.GetProjectOption("board_build.partitions", "")
+    csv_path = os.path.join(env.subst("$PROJECT_DIR"), csv_name) if csv_name else ""
+    if not os.path.isfile(csv_path):
+        return None, None
+    with open(csv_path) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#")[0].split(",")]
+            if len(cols) >= 5 and cols[0] == name:
+                return int(cols[3], 0), int(cols[4], 0)
+    return None, None
+
+
+def build_pack(staged_root):
+    files = []
+    for rel, full in staged_files(staged_root):  # sorted: firmware binary-searches the index
+        if len(rel) >= PACK_PATH_LEN:
+            print("[assets] path too long for the pack, skipped: %s" % rel)
+            continue
+        files.append((rel, full))
+
+    index = b""
+    body = bytearray()
+    data_start = 12 + len(files) * (PACK_PATH_LEN + 8)
+    for rel, full in files:
+        while (data_start + len(body)) % 4:
+            body.append(0)
+        with open(full, "rb") as f:
+            data = f.read()
+        index += struct.pack("<%dsII" % PACK_PATH_LEN, rel.encode(), data_start + len(body), len(data))
+        body += data
+    total = data_start + len(body)
+
+    header = struct.pack("<IHHI", PACK_MAGIC, PACK_VERSION, len(files), total)
+    return header + index + bytes(body)
+
+
+def stage_pack(staged_root):
+    part_offset, part_size = partition_offset(PACK_PARTITION)
+    if part_offset is None:
+        return
+
+    pack = build_pack(staged_root)
+    if len(pack) > part_size:
+        sys.stderr.write("[assets] pack is %d bytes but the '%s' partition is only %d\n"
+                         % (len(pack), PACK_PARTITION, part_size))
+        env.Exit(1)
+
+    pack_path = os.path.join(os.path.dirname(staged_root), "assets.bin")
+    old = None
+    if os.path.exists(pack_path):
+        with open(pack_path, "rb") as f:
+            old = f.read()
+    if old != pack:
+        with open(pack_path, "wb") as f:
+            f.write(pack)
+        print("[assets] packed %d KB for the '%s' partition" % (len(pack) // 1024, PACK_PARTITION))
+
+    env.Append(FLASH_EXTRA_IMAGES=[("0x%x" % part_offset, pack_path)])
+
+
+staged = stage_assets()
+if staged:
+    write_manifest(staged)
+    stage_pack(staged)
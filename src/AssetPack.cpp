@@ -0,0 +1,132 @@
+#include "AssetPack.h"
+#include <Arduino.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+
+// Layout written by scripts/lvgl_assets.py (little endian)
+#define ASSET_PACK_MAGIC     0x4B505753u   // "SWPK"
+#define ASSET_PACK_VERSION   1
+#define ASSET_PACK_PATH_LEN  48
+#define ASSET_PACK_SUBTYPE   0x40
+#define ASSET_PACK_LABEL     "assets"
+
+struct PackHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t totalSize;
+};
+
+struct PackEntry {
+    char     path[ASSET_PACK_PATH_LEN];
+    uint32_t offset;
+    uint32_t size;
+};
+
+static const uint8_t*   g_base    = nullptr;
+static const PackEntry* g_index   = nullptr;
+static uint16_t         g_count   = 0;
+static uint32_t         g_size    = 0;
+static lv_image_dsc_t*  g_images  = nullptr;   // lazily filled, one per entry
+static bool             g_tried   = false;
+
+bool asset_pack_init(void)
+{
+    if (g_tried) return g_base != nullptr;
+    g_tried = true;
+
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PACK_SUBTYPE, ASSET_PACK_LABEL);
+    if (!part) {
+        Serial.println("[Assets] no assets partition, using LittleFS");
+        return false;
+    }
+
+    PackHeader hdr;
+    if (esp_partition_read(part, 0, &hdr, sizeof(hdr)) != ESP_OK ||
+        hdr.magic != ASSET_PACK_MAGIC || hdr.version != ASSET_PACK_VERSION ||
+        hdr.totalSize > part->size ||
+        sizeof(hdr) + (uint32_t)hdr.count * sizeof(PackEntry) > hdr.totalSize) {
+        Serial.println("[Assets] assets partition not flashed (pio run -t upload writes it)");
+        return false;
+    }
+
+    const void* mapped = nullptr;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, hdr.totalSize, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        Serial.println("[Assets] mmap failed, using LittleFS");
+        return false;
+    }
+
+    g_images = (lv_image_dsc_t*)heap_caps_calloc(hdr.count, sizeof(lv_image_dsc_t), MALLOC_CAP_8BIT);
+    if (!g_images) {
+        esp_partition_munmap(handle);
+        return false;
+    }
+
+    g_base  = (const uint8_t*)mapped;
+    g_index = (const PackEntry*)(g_base + sizeof(PackHeader));
+    g_count = hdr.count;
+    g_size  = hdr.totalSize;
+    Serial.printf("[Assets] mapped %u files, %lu KB at %p\n",
+                  (unsigned)g_count, (unsigned long)(g_size / 1024), mapped);
+    return true;
+}
+
+// Index is sorted by path, so binary search
+static int find_entry(const char* path)
+{
+    if (!g_base || !path) return -1;
+    if (path[0] && path[1] == ':') path += 2;   // drop the LVGL drive letter
+
+    int lo = 0, hi = (int)g_count - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const int c = strncmp(path, g_index[mid].path, ASSET_PACK_PATH_LEN);
+        if (c == 0) return mid;
+        if (c < 0) hi = mid - 1;
+        else lo = mid + 1;
+    }
+    return -1;
+}
+
+const uint8_t* asset_pack_find(const char* path, uint32_t* size)
+{
+    const int i = find_entry(path);
+    if (i < 0) return nullptr;
+    if (size) *size = g_index[i].size;
+    return g_base + g_index[i].offset;
+}
+
+const lv_image_dsc_t* asset_pack_image(const char* path)
+{
+    const int i = find_entry(path);
+    if (i < 0) return nullptr;
+
+    lv_image_dsc_t& dsc = g_images[i];
+    if (dsc.header.magic == LV_IMAGE_HEADER_MAGIC) return &dsc;
+
+    const PackEntry& e = g_index[i];
+    if (e.size <= sizeof(lv_image_header_t)) return nullptr;
+
+    const uint8_t* file = g_base + e.offset;
+    lv_image_header_t header;
+    memcpy(&header, file, sizeof(header));
+    if (header.magic != LV_IMAGE_HEADER_MAGIC) return nullptr;   // not an image (e.g. a sound)
+
+    dsc.header    = header;
+    dsc.data_size = e.size - sizeof(header);
+    dsc.data      = file + sizeof(header);
+    return &dsc;
+}
+
+uint16_t asset_pack_count(void)
+{
+    return g_count;
+}
+
+uint32_t asset_pack_size(void)
+{
+    return g_size;
+}
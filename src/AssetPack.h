@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <lvgl.h>
+
+// Read-only asset partition, memory-mapped.
+//
+// scripts/lvgl_assets.py packs the converted data/lvgl tree (images + sounds)
+// into one blob with a sorted index and flashes it to the "assets" partition.
+// At boot we map the whole partition into the address space, so an image
+// descriptor can point straight at flash: no file open, no read, no heap copy.
+// The flash cache does the rest.
+//
+// If the partition is missing or holds no valid pack (e.g. an old flash
+// layout), everything here returns null and callers use LittleFS as before.
+
+// Map the partition and check the index. Safe to call more than once.
+bool asset_pack_init(void);
+
+// Raw file contents. `path` is an LVGL path ("A:/lvgl/...") or a plain
+// one ("/lvgl/..."). Returns nullptr if it isn't in the pack.
+const uint8_t* asset_pack_find(const char* path, uint32_t* size);
+
+// In-place descriptor for a packed LVGL .bin image, built on first request.
+// Pass to lv_image_set_src() like any other lv_image_dsc_t.
+const lv_image_dsc_t* asset_pack_image(const char* path);
+
+// Entry count and mapped size, for logging. Both 0 when not mapped.
+uint16_t asset_pack_count(void);
+uint32_t asset_pack_size(void);
@@ -2,6 +2,8 @@
 
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>  // brings in Arduino_GFX + Arduino_CO5300
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 
 DisplayManager& DisplayManager::instance()
 {
@@ -13,6 +15,11 @@ void DisplayManager::begin(Arduino_GFX* gfx)
 {
   gfx_ = gfx;
 
+  if(!busMutex_) {
+    busMutex_ = xSemaphoreCreateMutex();
+    if(!busMutex_) Serial.println("[Display] Failed to create bus mutex");
+  }
+
   // Don’t call begin() on gfx here; main.cpp owns the bring-up order.
   // But we can safely push cached state if gfx already began.
   // If you call setBrightness/setScreenOn before begin(), it will be cached.
@@ -88,6 +95,16 @@ void DisplayManager::tick()
   }
 }
 
+void DisplayManager::lockBus()
+{
+  if(busMutex_) xSemaphoreTake((SemaphoreHandle_t)busMutex_, portMAX_DELAY);
+}
+
+void DisplayManager::unlockBus()
+{
+  if(busMutex_) xSemaphoreGive((SemaphoreHandle_t)busMutex_);
+}
+
 void DisplayManager::applyBrightness_(uint8_t value)
 {
   if(!gfx_) return;
@@ -98,7 +115,9 @@ void DisplayManager::applyBrightness_(uint8_t value)
   // We *know* this board is Arduino_CO5300.
   // If you ever swap panels, this is the only place to change.
   auto* co = static_cast<Arduino_CO5300*>(gfx_);
+  lockBus();
   co->setBrightness(value);
+  unlockBus();
 }
 
 void DisplayManager::applyScreenOn_(bool on)
@@ -107,6 +126,8 @@ void DisplayManager::applyScreenOn_(bool on)
 
   // Arduino_CO5300 implements displayOn/Off on the driver
   auto* co = static_cast<Arduino_CO5300*>(gfx_);
+  lockBus();
   if(on) co->displayOn();
   else   co->displayOff();
+  unlockBus();
 }
@@ -36,6 +36,12 @@ public:
   // Call regularly (e.g. every loop) if you use fadeTo()
   void tick();
 
+  // The QSPI bus is shared between the LVGL flush task and the register
+  // writes above (brightness, on/off). Anyone talking to the panel from
+  // outside DisplayManager must hold this lock for the whole transaction.
+  void lockBus();
+  void unlockBus();
+
 private:
   DisplayManager() = default;
 
@@ -53,6 +59,9 @@ private:
   uint32_t fadeStartMs_ = 0;
   uint16_t fadeDurationMs_ = 0;
 
+  // guards the QSPI bus (created in begin())
+  void* busMutex_ = nullptr;
+
   // helpers
   void applyBrightness_(uint8_t value);
   void applyScreenOn_(bool on);
@@ -0,0 +1,185 @@
+#include "FrameProfiler.h"
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "ui.h"
+#include "uiWeatherScreen.h"
+#include "ui_Power.h"
+
+static const char* kScreenNames[(int)ProfScreen::Count] = {
+  "Main", "Clock", "Weather", "Settings", "Power", "Other"
+};
+
+static inline uint32_t now_us()
+{
+  return (uint32_t)esp_timer_get_time();
+}
+
+static ProfScreen screen_of(lv_obj_t* scr)
+{
+  if(scr == ui_MainScreen)    return ProfScreen::Main;
+  if(scr == ui_ClockScreen)   return ProfScreen::Clock;
+  if(scr == ui_WeatherScreen) return ProfScreen::Weather;
+  if(scr == ui_Settings)      return ProfScreen::Settings;
+  if(scr == ui_Power)         return ProfScreen::Power;
+  return ProfScreen::Other;
+}
+
+FrameProfiler& FrameProfiler::instance()
+{
+  static FrameProfiler inst;
+  return inst;
+}
+
+void FrameProfiler::begin(uint16_t capacity)
+{
+  if(ring_) return;
+
+  ring_ = (FrameRecord*)heap_caps_calloc(capacity, sizeof(FrameRecord),
+                                         MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if(!ring_) {
+    Serial.println("[Prof] ring alloc failed, profiler disabled");
+    return;
+  }
+  capacity_ = capacity;
+  Serial.printf("[Prof] %u frame records\n", (unsigned)capacity_);
+}
+
+void FrameProfiler::handlerStart(uint32_t lockWaitUs)
+{
+  frameOpen_ = false;
+  lockWaitUs_ = lockWaitUs;
+  flushWaitUs_ = 0;
+  handlerStartUs_ = now_us();
+}
+
+uint32_t FrameProfiler::flushQueued(uint16_t areas)
+{
+  if(!ring_) return 0;
+
+  // First flush of this handler call opens a new record
+  if(!frameOpen_) {
+    frameOpen_ = true;
+    if(++seq_ == 0) seq_ = 1;
+    FrameRecord* r = slot_(seq_);
+    memset(r, 0, sizeof(*r));
+    r->seq = seq_;
+  }
+  slot_(seq_)->areas += areas;
+  return seq_;
+}
+
+void FrameProfiler::flushWaited(uint32_t us)
+{
+  flushWaitUs_ += us;
+}
+
+void FrameProfiler::handlerEnd()
+{
+  if(!ring_ || !frameOpen_) return;
+  frameOpen_ = false;
+
+  const uint32_t total = now_us() - handlerStartUs_;
+  FrameRecord* r = slot_(seq_);
+  r->renderUs   = (total > flushWaitUs_) ? (total - flushWaitUs_) : 0;
+  r->lockWaitUs = lockWaitUs_;
+  r->screen     = (uint8_t)screen_of(lv_screen_active());
+}
+
+void FrameProfiler::flushDone(uint32_t seq, uint32_t us, uint32_t pixels)
+{
+  if(!ring_ || seq == 0) return;
+
+  // Partial mode sends several jobs per frame; they all add up here
+  FrameRecord* r = slot_(seq);
+  if(r->seq != seq) return;   // overwritten already
+  r->flushUs += us;
+  r->pixels  += pixels;
+}
+
+void FrameProfiler::reset()
+{
+  if(!ring_) return;
+  memset(ring_, 0, capacity_ * sizeof(FrameRecord));
+}
+
+static int cmp_u32(const void* a, const void* b)
+{
+  const uint32_t x = *(const uint32_t*)a;
+  const uint32_t y = *(const uint32_t*)b;
+  return (x > y) - (x < y);
+}
+
+static void print_stat(const char* label, uint32_t* v, uint16_t n, float scale, const char* unit)
+{
+  qsort(v, n, sizeof(uint32_t), cmp_u32);
+  Serial.printf("    %-9s p50 %8.2f  p90 %8.2f  p99 %8.2f  max %8.2f %s\n",
+                label,
+                v[(n - 1) * 50 / 100] * scale,
+                v[(n - 1) * 90 / 100] * scale,
+                v[(n - 1) * 99 / 100] * scale,
+                v[n - 1] * scale,
+                unit);
+}
+
+void FrameProfiler::dump()
+{
+  if(!ring_) {
+    Serial.println("[Prof] not running");
+    return;
+  }
+
+  uint32_t* tmp = (uint32_t*)heap_caps_malloc(capacity_ * sizeof(uint32_t),
+                                              MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if(!tmp) {
+    Serial.println("[Prof] no memory for dump");
+    return;
+  }
+
+  Serial.printf("[Prof] last %u frames (seq %u)\n", (unsigned)capacity_, (unsigned)seq_);
+
+  for(uint8_t s = 0; s < (uint8_t)ProfScreen::Count; s++) {
+    // Gather once to count, then per metric
+    uint16_t n = 0;
+    for(uint16_t i = 0; i < capacity_; i++) {
+      if(ring_[i].seq && ring_[i].screen == s) n++;
+    }
+    if(n == 0) continue;
+
+    Serial.printf("  %s: %u frames\n", kScreenNames[s], (unsigned)n);
+
+    const struct {
+      const char* label;
+      float scale;
+      const char* unit;
+    } metrics[] = {
+      { "render",   0.001f, "ms" },
+      { "flush",    0.001f, "ms" },
+      { "lockwait", 0.001f, "ms" },
+      { "areas",    1.0f,   ""   },
+      { "kpixels",  0.001f, ""   },
+    };
+
+    for(uint8_t m = 0; m < sizeof(metrics) / sizeof(metrics[0]); m++) {
+      uint16_t k = 0;
+      for(uint16_t i = 0; i < capacity_; i++) {
+        const FrameRecord& r = ring_[i];
+        if(!r.seq || r.screen != s) continue;
+        switch(m) {
+          case 0: tmp[k++] = r.renderUs;   break;
+          case 1: tmp[k++] = r.flushUs;    break;
+          case 2: tmp[k++] = r.lockWaitUs; break;
+          case 3: tmp[k++] = r.areas;      break;
+          default: tmp[k++] = r.pixels;    break;
+        }
+      }
+      print_stat(metrics[m].label, tmp, k, metrics[m].scale, metrics[m].unit);
+    }
+  }
+
+  heap_caps_free(tmp);
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Per-frame timing ring buffer for the LVGL pipeline.
+//
+// A "frame" is one lv_timer_handler() call that actually flushed something.
+// The LVGL task brackets the handler (handlerStart/handlerEnd) and reports
+// each queued flush job; the flush task reports how long the transfer took.
+// Dump percentiles per screen with the "prof" serial command.
+
+enum class ProfScreen : uint8_t {
+  Main = 0,
+  Clock,
+  Weather,
+  Settings,
+  Power,
+  Other,
+  Count
+};
+
+struct FrameRecord {
+  uint32_t seq;         // 0 = empty slot
+  uint32_t renderUs;    // lv_timer_handler time minus time blocked on the flush task
+  uint32_t flushUs;     // time the flush task spent pushing this frame
+  uint32_t lockWaitUs;  // time waiting for lvgl_lock before the handler
+  uint32_t pixels;      // pixels actually sent to the panel
+  uint16_t areas;       // rectangles flushed
+  uint8_t  screen;      // ProfScreen
+};
+
+class FrameProfiler
+{
+public:
+  static FrameProfiler& instance();
+
+  // Allocates the ring in PSRAM. Safe to skip: everything is a no-op until then.
+  void begin(uint16_t capacity = 256);
+
+  // --- LVGL task ---
+  void handlerStart(uint32_t lockWaitUs);
+  uint32_t flushQueued(uint16_t areas);   // returns the frame seq to hand to the flush task
+  void flushWaited(uint32_t us);          // time spent in the flush_wait_cb
+  void handlerEnd();                      // reads lv_screen_active(), call under the lock
+
+  // --- flush task ---
+  void flushDone(uint32_t seq, uint32_t us, uint32_t pixels);
+
+  // Percentiles per screen to Serial (call with the LVGL lock held)
+  void dump();
+  void reset();
+
+private:
+  FrameProfiler() = default;
+
+  FrameRecord* ring_ = nullptr;
+  uint16_t capacity_ = 0;
+
+  uint32_t seq_ = 0;          // last frame seq handed out
+  bool     frameOpen_ = false;
+  uint32_t handlerStartUs_ = 0;
+  uint32_t lockWaitUs_ = 0;
+  uint32_t flushWaitUs_ = 0;
+
+  FrameRecord* slot_(uint32_t seq) { return &ring_[seq % capacity_]; }
+};
@@ -0,0 +1,342 @@
+#include "ImageCache.h"
+#include "AssetPack.h"
+
+#include <Arduino.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#if LV_USE_FS_ARDUINO_ESP_LITTLEFS
+#include <LittleFS.h>
+#elif LV_USE_FS_POSIX
+#include <stdio.h>
+#endif
+
+ImageCache& ImageCache::instance()
+{
+  static ImageCache inst;
+  return inst;
+}
+
+void ImageCache::setBudget(uint32_t bytes)
+{
+  budget_ = bytes;
+  makeRoom_(0);
+}
+
+int ImageCache::find_(const char* path) const
+{
+  for(int i = 0; i < kMaxEntries; i++) {
+    if(entries_[i].path[0] && strcmp(entries_[i].path, path) == 0) return i;
+  }
+  return -1;
+}
+
+void ImageCache::evict_(int idx)
+{
+  Entry& e = entries_[idx];
+  lv_image_cache_drop(&e.dsc);
+  heap_caps_free(e.data);
+  stats_.bytes -= e.bytes;
+  stats_.entries--;
+  stats_.evictions++;
+  memset(&e, 0, sizeof(e));
+}
+
+// Evict least recently used, unpinned entries until `bytes` more would fit
+bool ImageCache::makeRoom_(uint32_t bytes)
+{
+  while(stats_.bytes + bytes > budget_) {
+    int victim = -1;
+    for(int i = 0; i < kMaxEntries; i++) {
+      const Entry& e = entries_[i];
+      if(!e.path[0] || e.pins) continue;
+      if(victim < 0 || e.lastUse < entries_[victim].lastUse) victim = i;
+    }
+    if(victim < 0) return false;
+    evict_(victim);
+  }
+  return true;
+}
+
+// Take ownership of already-read pixels. Returns the entry index, or -1 with
+// `data` freed if there's no room for it.
+int ImageCache::adopt_(const char* path, const lv_image_header_t& header, uint8_t* data, uint32_t bytes)
+{
+  int idx = -1;
+  if(strlen(path) < kPathLen && bytes <= budget_ && makeRoom_(bytes)) {
+    for(int i = 0; i < kMaxEntries; i++) {
+      if(!entries_[i].path[0]) { idx = i; break; }
+    }
+  }
+  if(idx < 0) {
+    heap_caps_free(data);
+    return -1;
+  }
+
+  Entry& e = entries_[idx];
+  strcpy(e.path, path);
+  e.dsc.header    = header;
+  e.dsc.data_size = bytes;
+  e.dsc.data      = data;
+  e.data          = data;
+  e.bytes         = bytes;
+  e.pins          = 0;
+  e.lastUse       = ++useCounter_;
+
+  stats_.bytes += bytes;
+  stats_.entries++;
+  if(stats_.bytes > stats_.peakBytes) stats_.peakBytes = stats_.bytes;
+  return idx;
+}
+
+int ImageCache::load_(const char* path)
+{
+  lv_fs_file_t f;
+  if(strlen(path) >= kPathLen || lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+    stats_.failures++;
+    return -1;
+  }
+
+  lv_image_header_t header;
+  uint32_t rn = 0;
+  uint32_t fileSize = 0;
+  bool ok = lv_fs_read(&f, &header, sizeof(header), &rn) == LV_FS_RES_OK &&
+            rn == sizeof(header) && header.magic == LV_IMAGE_HEADER_MAGIC;
+  if(ok) {
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &fileSize);
+    lv_fs_seek(&f, sizeof(header), LV_FS_SEEK_SET);
+    ok = fileSize > sizeof(header);
+  }
+
+  // Make room before allocating, so evicted pixels can be reused
+  const uint32_t bytes = fileSize - sizeof(header);
+  uint8_t* data = nullptr;
+  if(ok && bytes <= budget_ && makeRoom_(bytes)) {
+    data = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+  }
+  if(data) ok = lv_fs_read(&f, data, bytes, &rn) == LV_FS_RES_OK && rn == bytes;
+  lv_fs_close(&f);
+
+  int idx = -1;
+  if(data && ok) {
+    idx = adopt_(path, header, data, bytes);
+  } else if(data) {
+    heap_caps_free(data);
+  }
+
+  if(idx < 0) {
+    stats_.failures++;
+    Serial.printf("[ImgCache] can't cache %s (%lu bytes)\n", path, (unsigned long)bytes);
+  }
+  return idx;
+}
+
+bool ImageCache::readFile(const char* path, Blob& out)
+{
+  out.data = nullptr;
+  out.bytes = 0;
+#if LV_USE_FS_ARDUINO_ESP_LITTLEFS
+  // Same mapping as LVGL's driver: "A:/x" -> LittleFS "/x"
+  if(path[0] != LV_FS_ARDUINO_ESP_LITTLEFS_LETTER || path[1] != ':') return false;
+
+  File f = LittleFS.open(path + 2, "r");
+  if(!f) return false;
+
+  bool ok = f.read((uint8_t*)&out.header, sizeof(out.header)) == sizeof(out.header) &&
+            out.header.magic == LV_IMAGE_HEADER_MAGIC && f.size() > sizeof(out.header);
+  if(ok) {
+    out.bytes = f.size() - sizeof(out.header);
+    out.data = (uint8_t*)heap_caps_malloc(out.bytes, MALLOC_CAP_SPIRAM);
+    ok = out.data && f.read(out.data, out.bytes) == out.bytes;
+  }
+  f.close();
+
+  if(!ok && out.data) {
+    heap_caps_free(out.data);
+    out.data = nullptr;
+  }
+  return ok;
+#elif LV_USE_FS_POSIX
+  // Host bench: same mapping as LVGL's POSIX driver, "A:/x" -> LV_FS_POSIX_PATH "/x"
+  if(path[0] != LV_FS_POSIX_LETTER || path[1] != ':') return false;
+
+  char full[128];
+  snprintf(full, sizeof(full), "%s%s", LV_FS_POSIX_PATH, path + 2);
+  FILE* f = fopen(full, "rb");
+  if(!f) return false;
+
+  long size = -1;
+  if(fseek(f, 0, SEEK_END) == 0) size = ftell(f);
+  bool ok = size > (long)sizeof(out.header) && fseek(f, 0, SEEK_SET) == 0 &&
+            fread(&out.header, sizeof(out.header), 1, f) == 1 &&
+            out.header.magic == LV_IMAGE_HEADER_MAGIC;
+  if(ok) {
+    out.bytes = (uint32_t)(size - sizeof(out.header));
+    out.data = (uint8_t*)heap_caps_malloc(out.bytes, MALLOC_CAP_SPIRAM);
+    ok = out.data && fread(out.data, 1, out.bytes, f) == out.bytes;
+  }
+  fclose(f);
+
+  if(!ok && out.data) {
+    heap_caps_free(out.data);
+    out.data = nullptr;
+  }
+  return ok;
+#else
+  (void)path;
+  return false;
+#endif
+}
+
+bool ImageCache::contains(const char* path) const
+{
+  return find_(path) >= 0 || asset_pack_image(path) != nullptr;
+}
+
+bool ImageCache::insert(const char* path, Blob& blob)
+{
+  uint8_t* data = blob.data;
+  blob.data = nullptr;
+  if(!data) return false;
+
+  if(find_(path) >= 0) {      // someone loaded it meanwhile
+    heap_caps_free(data);
+    return true;
+  }
+  if(adopt_(path, blob.header, data, blob.bytes) < 0) {
+    stats_.failures++;
+    return false;
+  }
+  stats_.prefetches++;
+  return true;
+}
+
+void ImageCache::pin_(lv_obj_t* img, int idx)
+{
+  Holder* h = nullptr;
+  Holder* freeHolder = nullptr;
+  for(int i = 0; i < kMaxHolders; i++) {
+    if(holders_[i].obj == img) { h = &holders_[i]; break; }
+    if(!holders_[i].obj && !freeHolder) freeHolder = &holders_[i];
+  }
+  if(!h) {
+    if(idx < 0) return;
+    if(!freeHolder) {
+      // More cached images on screen than holders; keep it pinned for good
+      // rather than risk freeing pixels that are still drawn.
+      entries_[idx].pins++;
+      return;
+    }
+    h = freeHolder;
+    h->obj = img;
+    h->entry = -1;
+    lv_obj_add_event_cb(img, onImageDeleted_, LV_EVENT_DELETE, nullptr);
+  }
+
+  if(h->entry == idx) return;
+  if(h->entry >= 0) entries_[h->entry].pins--;
+  if(idx >= 0) entries_[idx].pins++;
+  h->entry = (int8_t)idx;
+}
+
+void ImageCache::onImageDeleted_(lv_event_t* e)
+{
+  ImageCache& self = instance();
+  lv_obj_t* obj = lv_event_get_target_obj(e);
+  for(int i = 0; i < kMaxHolders; i++) {
+    Holder& h = self.holders_[i];
+    if(h.obj != obj) continue;
+    if(h.entry >= 0) self.entries_[h.entry].pins--;
+    h.obj = nullptr;
+    h.entry = -1;
+  }
+}
+
+void ImageCache::setSrc(lv_obj_t* img, const char* path)
+{
+  if(!img || !path) return;
+
+  // Flash-mapped pack: nothing to load or budget, LVGL reads it in place
+  if(const lv_image_dsc_t* mapped = asset_pack_image(path)) {
+    stats_.mapped++;
+    pin_(img, -1);
+    lv_image_set_src(img, mapped);
+    return;
+  }
+
+  int idx = find_(path);
+  if(idx >= 0) {
+    stats_.hits++;
+  } else {
+    stats_.misses++;
+    idx = load_(path);
+  }
+
+  if(idx < 0) {
+    pin_(img, -1);
+    lv_image_set_src(img, path);   // let LVGL read it from the file
+    return;
+  }
+
+  entries_[idx].lastUse = ++useCounter_;
+  pin_(img, idx);
+  lv_image_set_src(img, &entries_[idx].dsc);
+}
+
+bool ImageCache::preload(const char* path)
+{
+  if(!path) return false;
+  if(asset_pack_image(path)) return true;
+  int idx = find_(path);
+  if(idx >= 0) {
+    stats_.hits++;
+  } else {
+    stats_.misses++;
+    idx = load_(path);
+  }
+  if(idx < 0) return false;
+  entries_[idx].lastUse = ++useCounter_;
+  return true;
+}
+
+ImageCache::Stats ImageCache::stats() const
+{
+  Stats s = stats_;
+  s.budget = budget_;
+  return s;
+}
+
+void ImageCache::resetStats()
+{
+  stats_.hits = 0;
+  stats_.misses = 0;
+  stats_.evictions = 0;
+  stats_.failures = 0;
+  stats_.prefetches = 0;
+  stats_.mapped = 0;
+  stats_.peakBytes = stats_.bytes;
+}
+
+void ImageCache::dump() const
+{
+  const uint32_t lookups = stats_.hits + stats_.misses;
+  Serial.printf("[ImgCache] %u entries, %lu / %lu KB (peak %lu KB)\n",
+                (unsigned)stats_.entries, (unsigned long)(stats_.bytes / 1024),
+                (unsigned long)(budget_ / 1024), (unsigned long)(stats_.peakBytes / 1024));
+  Serial.printf("[ImgCache] hits %lu  misses %lu  (%lu%% hit)  prefetched %lu  evictions %lu  failures %lu\n",
+                (unsigned long)stats_.hits, (unsigned long)stats_.misses,
+                (unsigned long)(lookups ? stats_.hits * 100 / lookups : 0),
+                (unsigned long)stats_.prefetches,
+                (unsigned long)stats_.evictions, (unsigned long)stats_.failures);
+  if(asset_pack_count()) {
+    Serial.printf("[ImgCache] asset pack: %u files, %lu KB mapped, %lu sources served from flash\n",
+                  (unsigned)asset_pack_count(), (unsigned long)(asset_pack_size() / 1024),
+                  (unsigned long)stats_.mapped);
+  }
+  for(int i = 0; i < kMaxEntries; i++) {
+    const Entry& e = entries_[i];
+    if(!e.path[0]) continue;
+    Serial.printf("  %-40s %4lu KB  %ux%u%s\n", e.path, (unsigned long)(e.bytes / 1024),
+                  (unsigned)e.dsc.header.w, (unsigned)e.dsc.header.h, e.pins ? "  (shown)" : "");
+  }
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+// Decoded image cache in PSRAM for the "A:/lvgl/..." .bin assets.
+//
+// A .bin is already raw pixels, so "decoding" is just reading it off LittleFS.
+// That still costs a few ms for a 350x350 background, and LVGL's own cache would
+// hold the result in its small internal heap. Here the whole file is loaded once
+// into PSRAM and LVGL gets an in-memory descriptor, which it draws directly.
+//
+// Entries are evicted LRU-first to stay within a byte budget. An entry shown by
+// an lv_image (set via setSrc) is pinned until that object shows something
+// else or is deleted, so eviction never pulls pixels out from under the UI.
+//
+// Sized against data/lvgl: each weather background is 245 KB (350x350 RGB565),
+// an icon 3 KB (32x32 RGB565A8). The default 1 MB keeps all icons plus three
+// backgrounds: the current one, the next one, and one more.
+//
+// When the assets partition is flashed (see AssetPack.h) images come straight
+// from flash-mapped memory and never enter this cache; it's the LittleFS path.
+
+#define IMAGE_CACHE_BUDGET_BYTES (1024u * 1024u)
+
+class ImageCache
+{
+public:
+  struct Stats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t failures;     // file missing / bad header / no PSRAM
+    uint32_t prefetches;   // entries added by insert() ahead of use
+    uint32_t mapped;       // setSrc() calls served from the asset partition
+    uint32_t bytes;        // currently resident
+    uint32_t peakBytes;
+    uint32_t budget;
+    uint16_t entries;
+  };
+
+  static ImageCache& instance();
+
+  void setBudget(uint32_t bytes);   // evicts unpinned entries down to the new budget
+
+  // Show `path` on an lv_image through the cache. Falls back to plain
+  // lv_image_set_src(path) if the image can't be cached. Call with the LVGL lock held.
+  void setSrc(lv_obj_t* img, const char* path);
+
+  // Load into the cache without showing it. Reads the file with the LVGL lock held.
+  bool preload(const char* path);
+
+  // Two-step preload for callers that shouldn't hold the LVGL lock through a
+  // 245 KB file read: readFile() needs no lock and touches no cache state,
+  // insert() (lock held) takes ownership of the pixels.
+  struct Blob {
+    lv_image_header_t header;
+    uint8_t*          data;
+    uint32_t          bytes;
+  };
+  static bool readFile(const char* path, Blob& out);
+  bool insert(const char* path, Blob& blob);   // frees blob.data if not kept
+  bool contains(const char* path) const;   // cached or in the flash-mapped pack
+
+  Stats stats() const;
+  void dump() const;          // stats + entries to Serial
+  void resetStats();
+
+private:
+  ImageCache() = default;
+
+  static constexpr int kMaxEntries = 32;   // whole asset set is ~26 images
+  static constexpr int kMaxHolders = 8;
+  static constexpr int kPathLen = 48;
+
+  struct Entry {
+    char           path[kPathLen];   // "" = free
+    lv_image_dsc_t dsc;
+    uint8_t*       data;
+    uint32_t       bytes;
+    uint32_t       lastUse;
+    uint8_t        pins;
+  };
+
+  struct Holder {
+    lv_obj_t* obj;
+    int8_t    entry;
+  };
+
+  int find_(const char* path) const;
+  int load_(const char* path);                   // miss path, returns entry index or -1
+  int adopt_(const char* path, const lv_image_header_t& header, uint8_t* data, uint32_t bytes);
+  bool makeRoom_(uint32_t bytes);
+  void evict_(int idx);
+  void pin_(lv_obj_t* img, int idx);
+  static void onImageDeleted_(lv_event_t* e);
+
+  Entry  entries_[kMaxEntries] = {};
+  Holder holders_[kMaxHolders] = {};
+  uint32_t budget_ = IMAGE_CACHE_BUDGET_BYTES;
+  uint32_t useCounter_ = 0;
+  Stats stats_ = {};
+};
@@ -0,0 +1,207 @@
+#include "LvglHeap.h"
+#include <Arduino.h>
+#include <lvgl.h>
+#include <string.h>
+#include <atomic>
+#include "esp_heap_caps.h"
+
+// Every block carries a small header so free/realloc know the size and tier
+// without asking the heap. 8 bytes keeps the heap's own alignment.
+struct BlockHeader {
+  uint32_t size;
+  uint32_t tier;
+};
+
+static const uint32_t kTierCaps[LVGL_HEAP_TIER_COUNT] = {
+  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+  MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+};
+
+struct TierCounters {
+  std::atomic<uint32_t> bytes;
+  std::atomic<uint32_t> peak;
+  std::atomic<uint32_t> blocks;
+  std::atomic<uint32_t> fallbacks;
+  std::atomic<uint32_t> failures;
+};
+
+static TierCounters g_tiers[LVGL_HEAP_TIER_COUNT];
+
+static void account_alloc(uint32_t tier, uint32_t size)
+{
+  TierCounters& t = g_tiers[tier];
+  const uint32_t now = t.bytes.fetch_add(size) + size;
+  t.blocks.fetch_add(1);
+  uint32_t peak = t.peak.load();
+  while (now > peak && !t.peak.compare_exchange_weak(peak, now)) {}
+}
+
+static void account_free(uint32_t tier, uint32_t size)
+{
+  g_tiers[tier].bytes.fetch_sub(size);
+  g_tiers[tier].blocks.fetch_sub(1);
+}
+
+static LvglHeapTier preferred_tier(size_t size)
+{
+  if (size > LVGL_HEAP_SMALL_MAX) return LVGL_HEAP_PSRAM;
+  if (g_tiers[LVGL_HEAP_INTERNAL].bytes.load() + size > LVGL_HEAP_INTERNAL_BUDGET) return LVGL_HEAP_PSRAM;
+  if (heap_caps_get_free_size(kTierCaps[LVGL_HEAP_INTERNAL]) < LVGL_HEAP_INTERNAL_RESERVE + size) {
+    return LVGL_HEAP_PSRAM;
+  }
+  return LVGL_HEAP_INTERNAL;
+}
+
+// Allocate with header in `tier`, falling back to the other one
+static void* tier_alloc(size_t size, LvglHeapTier tier)
+{
+  const size_t total = size + sizeof(BlockHeader);
+  uint32_t got = tier;
+  BlockHeader* h = (BlockHeader*)heap_caps_malloc(total, kTierCaps[tier]);
+  if (!h) {
+    got = (tier == LVGL_HEAP_INTERNAL) ? LVGL_HEAP_PSRAM : LVGL_HEAP_INTERNAL;
+    h = (BlockHeader*)heap_caps_malloc(total, kTierCaps[got]);
+    if (!h) {
+      g_tiers[tier].failures.fetch_add(1);
+      return nullptr;
+    }
+  }
+
+  // Count blocks that ended up outside their size class (budget, reserve or OOM)
+  const uint32_t sizeClass = size > LVGL_HEAP_SMALL_MAX ? LVGL_HEAP_PSRAM : LVGL_HEAP_INTERNAL;
+  if (got != sizeClass) g_tiers[got].fallbacks.fetch_add(1);
+
+  h->size = (uint32_t)size;
+  h->tier = got;
+  account_alloc(got, (uint32_t)size);
+  return h + 1;
+}
+
+extern "C" {
+
+void lv_mem_init(void)
+{
+  // Nothing to set up; the system heaps are already there
+}
+
+void lv_mem_deinit(void)
+{
+}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes)
+{
+  (void)mem;
+  (void)bytes;
+  return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+  (void)pool;
+}
+
+void* lv_malloc_core(size_t size)
+{
+  return tier_alloc(size, preferred_tier(size));
+}
+
+void lv_free_core(void* p)
+{
+  if (!p) return;
+  BlockHeader* h = (BlockHeader*)p - 1;
+  account_free(h->tier, h->size);
+  heap_caps_free(h);
+}
+
+void* lv_realloc_core(void* p, size_t new_size)
+{
+  if (!p) return lv_malloc_core(new_size);
+
+  BlockHeader* h = (BlockHeader*)p - 1;
+  const uint32_t oldTier = h->tier;
+  const uint32_t oldSize = h->size;
+  const LvglHeapTier want = preferred_tier(new_size);
+
+  // Same tier: let the heap grow/shrink in place if it can
+  if (want == oldTier) {
+    BlockHeader* nh = (BlockHeader*)heap_caps_realloc(h, new_size + sizeof(BlockHeader), kTierCaps[oldTier]);
+    if (nh) {
+      account_free(oldTier, oldSize);
+      nh->size = (uint32_t)new_size;
+      account_alloc(oldTier, (uint32_t)new_size);
+      return nh + 1;
+    }
+  }
+
+  // Crossing tiers (or in-place failed): copy
+  void* np = tier_alloc(new_size, want);
+  if (!np) return nullptr;
+  memcpy(np, p, oldSize < new_size ? oldSize : new_size);
+  lv_free_core(p);
+  return np;
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon)
+{
+  memset(mon, 0, sizeof(*mon));
+  uint32_t used = 0, peak = 0, blocks = 0, largest = 0, freeSz = 0;
+  for (int i = 0; i < LVGL_HEAP_TIER_COUNT; i++) {
+    LvglHeapTierStats s;
+    lvgl_heap_stats((LvglHeapTier)i, &s);
+    used    += s.bytes;
+    peak    += s.peak;
+    blocks  += s.blocks;
+    freeSz  += s.heapFree;
+    if (s.heapLargest > largest) largest = s.heapLargest;
+  }
+  mon->total_size        = used + freeSz;
+  mon->free_size         = freeSz;
+  mon->free_biggest_size = largest;
+  mon->used_cnt          = blocks;
+  mon->max_used          = peak;
+  mon->used_pct          = mon->total_size ? (uint8_t)((uint64_t)used * 100 / mon->total_size) : 0;
+  mon->frag_pct          = freeSz ? (uint8_t)(100 - (uint64_t)largest * 100 / freeSz) : 0;
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+  return heap_caps_check_integrity_all(true) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+}  // extern "C"
+
+void lvgl_heap_stats(LvglHeapTier tier, LvglHeapTierStats* out)
+{
+  const TierCounters& t = g_tiers[tier];
+  out->bytes       = t.bytes.load();
+  out->peak        = t.peak.load();
+  out->blocks      = t.blocks.load();
+  out->fallbacks   = t.fallbacks.load();
+  out->failures    = t.failures.load();
+  out->heapFree    = (uint32_t)heap_caps_get_free_size(kTierCaps[tier]);
+  out->heapLargest = (uint32_t)heap_caps_get_largest_free_block(kTierCaps[tier]);
+  out->fragPct     = out->heapFree ? (uint8_t)(100 - (uint64_t)out->heapLargest * 100 / out->heapFree) : 0;
+}
+
+void lvgl_heap_dump(const char* tag)
+{
+  static const char* const names[LVGL_HEAP_TIER_COUNT] = { "internal", "psram" };
+  Serial.printf("[LvHeap] %s\n", tag ? tag : "");
+  for (int i = 0; i < LVGL_HEAP_TIER_COUNT; i++) {
+    LvglHeapTierStats s;
+    lvgl_heap_stats((LvglHeapTier)i, &s);
+    Serial.printf("  %-8s lvgl %6lu B in %4lu blocks (peak %6lu)  fallbacks %lu  failed %lu | heap free %7lu largest %7lu frag %u%%\n",
+                  names[i], (unsigned long)s.bytes, (unsigned long)s.blocks, (unsigned long)s.peak,
+                  (unsigned long)s.fallbacks, (unsigned long)s.failures,
+                  (unsigned long)s.heapFree, (unsigned long)s.heapLargest, (unsigned)s.fragPct);
+  }
+}
+
+void lvgl_heap_reset_peaks(void)
+{
+  for (int i = 0; i < LVGL_HEAP_TIER_COUNT; i++) {
+    g_tiers[i].peak.store(g_tiers[i].bytes.load());
+    g_tiers[i].fallbacks.store(0);
+    g_tiers[i].failures.store(0);
+  }
+}
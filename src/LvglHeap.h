@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+
+// LVGL allocator (LV_USE_STDLIB_MALLOC = LV_STDLIB_CUSTOM in lv_conf.h).
+//
+// The builtin 128 KB pool sat in internal RAM whether LVGL used it or not,
+// and WiFi/TLS is short of exactly that RAM. Instead, LVGL's allocations go
+// to the system heaps in two tiers:
+//  - small blocks (objects, styles, label text, draw tasks) -> internal RAM,
+//    while LVGL's internal total stays under a budget and the heap keeps a
+//    reserve free for the network stack
+//  - large blocks (draw buffers, layers, canvases, decoded images) -> PSRAM
+// Either tier falls back to the other rather than fail.
+
+#define LVGL_HEAP_SMALL_MAX        2048            // bytes; larger goes to PSRAM
+#define LVGL_HEAP_INTERNAL_BUDGET  (96 * 1024)     // LVGL's own internal-RAM ceiling
+#define LVGL_HEAP_INTERNAL_RESERVE (48 * 1024)     // leave this much internal free (TLS handshake)
+
+enum LvglHeapTier : uint8_t {
+  LVGL_HEAP_INTERNAL = 0,
+  LVGL_HEAP_PSRAM,
+  LVGL_HEAP_TIER_COUNT
+};
+
+struct LvglHeapTierStats {
+  uint32_t bytes;        // currently allocated by LVGL in this tier
+  uint32_t peak;
+  uint32_t blocks;
+  uint32_t fallbacks;    // allocations that wanted the other tier but got this one
+  uint32_t failures;
+  uint32_t heapFree;     // whole system heap for this tier, not just LVGL
+  uint32_t heapLargest;
+  uint8_t  fragPct;      // 100 - largest/free
+};
+
+// Safe from any task; no LVGL lock needed.
+void lvgl_heap_stats(LvglHeapTier tier, LvglHeapTierStats* out);
+void lvgl_heap_dump(const char* tag);
+void lvgl_heap_reset_peaks(void);
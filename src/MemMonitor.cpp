@@ -0,0 +1,149 @@
+#include "MemMonitor.h"
+#include <Arduino.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+
+static const char* const kPhaseNames[(int)MemPhase::Count] = {
+  "boot", "idle", "weather", "tide", "screen"
+};
+
+static const char* const kHeapNames[(int)MemHeap::Count] = {
+  "internal", "dma", "psram"
+};
+
+static const uint32_t kHeapCaps[(int)MemHeap::Count] = {
+  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+  MALLOC_CAP_DMA,
+  MALLOC_CAP_SPIRAM,
+};
+
+MemMonitor& MemMonitor::instance()
+{
+  static MemMonitor inst;
+  return inst;
+}
+
+void MemMonitor::begin(uint32_t periodMs)
+{
+  if(task_) return;
+  periodMs_ = periodMs;
+  reset();
+  record_(MemPhase::Boot);
+
+  // Lowest priority: a missed sample costs nothing, a delayed UI frame does
+  xTaskCreatePinnedToCore(taskEntry_, "memmon", 3072, this, 1, &task_, 0);
+  if(task_) watchTask(task_, 3072);
+}
+
+void MemMonitor::taskEntry_(void* arg)
+{
+  MemMonitor* self = (MemMonitor*)arg;
+  for(;;) {
+    vTaskDelay(pdMS_TO_TICKS(self->periodMs_));
+    self->record_((MemPhase)self->phase_);
+  }
+}
+
+void MemMonitor::watchTask(TaskHandle_t task, uint32_t stackBytes)
+{
+  if(!task) return;
+  portENTER_CRITICAL(&mux_);
+  for(int i = 0; i < kMaxTasks; i++) {
+    if(tasks_[i].handle == task || !tasks_[i].handle) {
+      tasks_[i].handle     = task;
+      tasks_[i].stackBytes = stackBytes;
+      tasks_[i].minFree    = UINT32_MAX;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&mux_);
+  record_((MemPhase)phase_);
+}
+
+MemPhase MemMonitor::setPhase(MemPhase phase)
+{
+  const MemPhase prev = (MemPhase)phase_;
+  record_(prev);           // close out the old phase with a fresh reading
+  phase_ = (uint8_t)phase;
+  record_(phase);
+  return prev;
+}
+
+void MemMonitor::sample(MemPhase phase)
+{
+  record_(phase);
+}
+
+void MemMonitor::record_(MemPhase phase)
+{
+  // Read outside the critical section; these take their own locks
+  uint32_t freeSz[(int)MemHeap::Count];
+  uint32_t largest[(int)MemHeap::Count];
+  for(int h = 0; h < (int)MemHeap::Count; h++) {
+    freeSz[h]  = heap_caps_get_free_size(kHeapCaps[h]);
+    largest[h] = heap_caps_get_largest_free_block(kHeapCaps[h]);
+  }
+  uint32_t stackFree[kMaxTasks];
+  for(int i = 0; i < kMaxTasks; i++) {
+    // ESP-IDF reports the high-water mark in bytes
+    stackFree[i] = tasks_[i].handle ? uxTaskGetStackHighWaterMark(tasks_[i].handle) : 0;
+  }
+
+  portENTER_CRITICAL(&mux_);
+  PhaseStats& p = phases_[(int)phase];
+  for(int h = 0; h < (int)MemHeap::Count; h++) {
+    MemHeapRange& r = p.heaps[h];
+    if(p.samples == 0 || freeSz[h] < r.freeMin) r.freeMin = freeSz[h];
+    if(p.samples == 0 || freeSz[h] > r.freeMax) r.freeMax = freeSz[h];
+    if(p.samples == 0 || largest[h] < r.largestMin) r.largestMin = largest[h];
+  }
+  p.samples++;
+  for(int i = 0; i < kMaxTasks; i++) {
+    if(tasks_[i].handle && stackFree[i] < tasks_[i].minFree) {
+      tasks_[i].minFree  = stackFree[i];
+      tasks_[i].minPhase = (uint8_t)phase;
+    }
+  }
+  portEXIT_CRITICAL(&mux_);
+}
+
+void MemMonitor::reset()
+{
+  portENTER_CRITICAL(&mux_);
+  memset(phases_, 0, sizeof(phases_));
+  for(int i = 0; i < kMaxTasks; i++) tasks_[i].minFree = UINT32_MAX;
+  portEXIT_CRITICAL(&mux_);
+}
+
+void MemMonitor::dump()
+{
+  PhaseStats phases[(int)MemPhase::Count];
+  TaskWatch tasks[kMaxTasks];
+  portENTER_CRITICAL(&mux_);
+  memcpy(phases, phases_, sizeof(phases));
+  memcpy(tasks, tasks_, sizeof(tasks));
+  portEXIT_CRITICAL(&mux_);
+
+  Serial.printf("[Mem] phase now: %s\n", kPhaseNames[phase_]);
+  Serial.println("  phase    samples  heap      free min..max        largest min");
+  for(int p = 0; p < (int)MemPhase::Count; p++) {
+    if(!phases[p].samples) continue;
+    for(int h = 0; h < (int)MemHeap::Count; h++) {
+      const MemHeapRange& r = phases[p].heaps[h];
+      Serial.printf("  %-8s %7lu  %-8s %8lu..%-8lu  %8lu\n",
+                    h == 0 ? kPhaseNames[p] : "", h == 0 ? (unsigned long)phases[p].samples : 0UL,
+                    kHeapNames[h], (unsigned long)r.freeMin, (unsigned long)r.freeMax,
+                    (unsigned long)r.largestMin);
+    }
+  }
+
+  Serial.println("  task        stack   min free  peak used  (worst phase)");
+  for(int i = 0; i < kMaxTasks; i++) {
+    const TaskWatch& t = tasks[i];
+    if(!t.handle || t.minFree == UINT32_MAX) continue;
+    const uint32_t used = t.stackBytes > t.minFree ? t.stackBytes - t.minFree : 0;
+    Serial.printf("  %-10s %6lu   %8lu   %8lu  (%s)\n",
+                  pcTaskGetName(t.handle), (unsigned long)t.stackBytes,
+                  (unsigned long)t.minFree, (unsigned long)used, kPhaseNames[t.minPhase]);
+  }
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Heap and stack watermarks, sampled periodically and at phase boundaries.
+//
+// Every sample reads free + largest-block for the internal, DMA and PSRAM
+// heaps and folds them into min/max for the current phase, so "how low did
+// internal RAM get during the tide fetch" has an answer. Registered tasks get
+// their stack high-water mark tracked the same way. Dump with "mem".
+
+enum class MemPhase : uint8_t {
+  Boot = 0,
+  Idle,
+  WeatherFetch,
+  TideFetch,
+  ScreenChange,
+  Count
+};
+
+enum class MemHeap : uint8_t {
+  Internal = 0,
+  Dma,
+  Psram,
+  Count
+};
+
+struct MemHeapRange {
+  uint32_t freeMin;
+  uint32_t freeMax;
+  uint32_t largestMin;
+};
+
+class MemMonitor
+{
+public:
+  static MemMonitor& instance();
+
+  // Starts the sampling task. Phase is Boot until setPhase(Idle).
+  void begin(uint32_t periodMs = 1000);
+
+  // Track a task's stack. stackBytes is what it was created with (0 = unknown).
+  void watchTask(TaskHandle_t task, uint32_t stackBytes);
+
+  MemPhase setPhase(MemPhase phase);   // samples, switches, returns the previous phase
+  void sample(MemPhase phase);         // one-off sample attributed to `phase`
+
+  void dump();
+  void reset();
+
+private:
+  MemMonitor() = default;
+
+  static constexpr int kMaxTasks = 6;
+
+  struct TaskWatch {
+    TaskHandle_t handle;
+    uint32_t     stackBytes;
+    uint32_t     minFree;     // bytes, lowest high-water mark seen
+    uint8_t      minPhase;    // phase it was seen in
+  };
+
+  struct PhaseStats {
+    uint32_t     samples;
+    MemHeapRange heaps[(int)MemHeap::Count];
+  };
+
+  static void taskEntry_(void* arg);
+  void record_(MemPhase phase);
+
+  TaskWatch  tasks_[kMaxTasks] = {};
+  PhaseStats phases_[(int)MemPhase::Count] = {};
+  volatile uint8_t phase_ = (uint8_t)MemPhase::Boot;
+  uint32_t periodMs_ = 1000;
+  TaskHandle_t task_ = nullptr;
+  portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+};
+
+// Attributes everything in a block to a phase, then restores the previous one
+class MemPhaseScope
+{
+public:
+  explicit MemPhaseScope(MemPhase phase) : prev_(MemMonitor::instance().setPhase(phase)) {}
+  ~MemPhaseScope() { MemMonitor::instance().setPhase(prev_); }
+
+private:
+  MemPhase prev_;
+};
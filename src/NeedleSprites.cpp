@@ -0,0 +1,223 @@
+#include "NeedleSprites.h"
+#include <Arduino.h>
+#include <math.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+
+#define NEEDLE_SPRITE_SLOTS   8   // 4 needle objects on the clock + room to not thrash
+#define NEEDLE_SPRITE_HOLDERS 8
+
+struct NeedleSlot {
+    const lv_image_dsc_t* src;      // nullptr = empty
+    int32_t        angle10;
+    int32_t        originX;         // sprite top-left relative to the pivot
+    int32_t        originY;
+    lv_image_dsc_t dsc;
+    uint8_t*       data;
+    uint32_t       cap;
+    uint32_t       lastUse;
+    uint8_t        pins;            // objects currently showing this sprite
+};
+
+struct NeedleHolder {
+    lv_obj_t* obj;
+    int8_t    slot;
+};
+
+static NeedleSlot   g_slots[NEEDLE_SPRITE_SLOTS];
+static NeedleHolder g_holders[NEEDLE_SPRITE_HOLDERS];
+static uint32_t     g_useCounter = 0;
+
+// Rotate an RGB565A8 image around (px, py) into slot s. Bilinear, alpha-weighted,
+// so the AA fringe of the source survives the rotation.
+static bool render_slot(NeedleSlot& s, const lv_image_dsc_t* src,
+                        int32_t px, int32_t py, int32_t angle10)
+{
+    const int32_t sw = src->header.w;
+    const int32_t sh = src->header.h;
+    const float a  = (float)angle10 * (float)M_PI / 1800.0f;
+    const float ca = cosf(a);
+    const float sa = sinf(a);
+
+    // Bounding box of the rotated source, relative to the pivot
+    const float cornersX[4] = { (float)-px, (float)(sw - px), (float)-px, (float)(sw - px) };
+    const float cornersY[4] = { (float)-py, (float)-py, (float)(sh - py), (float)(sh - py) };
+    float minX = 1e9f, minY = 1e9f, maxX = -1e9f, maxY = -1e9f;
+    for (int i = 0; i < 4; i++) {
+        const float rx = cornersX[i] * ca - cornersY[i] * sa;
+        const float ry = cornersX[i] * sa + cornersY[i] * ca;
+        minX = fminf(minX, rx); maxX = fmaxf(maxX, rx);
+        minY = fminf(minY, ry); maxY = fmaxf(maxY, ry);
+    }
+    const int32_t x0 = (int32_t)floorf(minX) - 1;
+    const int32_t y0 = (int32_t)floorf(minY) - 1;
+    const int32_t w  = (int32_t)ceilf(maxX) + 1 - x0;
+    const int32_t h  = (int32_t)ceilf(maxY) + 1 - y0;
+    const uint32_t size = (uint32_t)(w * h * 3);
+
+    if (s.cap < size) {
+        if (s.data) heap_caps_free(s.data);
+        s.data = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        s.cap  = s.data ? size : 0;
+        if (!s.data) return false;
+    }
+
+    const uint16_t* inRgb = (const uint16_t*)src->data;
+    const uint8_t*  inA   = src->data + sw * sh * 2;
+    uint16_t*       outRgb = (uint16_t*)s.data;
+    uint8_t*        outA   = s.data + w * h * 2;
+
+    for (int32_t dy = 0; dy < h; dy++) {
+        for (int32_t dx = 0; dx < w; dx++) {
+            // Destination pixel centre -> source space (inverse rotation)
+            const float ox = (float)(x0 + dx) + 0.5f;
+            const float oy = (float)(y0 + dy) + 0.5f;
+            const float sx = ox * ca + oy * sa + (float)px - 0.5f;
+            const float sy = -ox * sa + oy * ca + (float)py - 0.5f;
+
+            const int32_t ix = (int32_t)floorf(sx);
+            const int32_t iy = (int32_t)floorf(sy);
+            const float   fx = sx - (float)ix;
+            const float   fy = sy - (float)iy;
+
+            float sumA = 0.0f, sumR = 0.0f, sumG = 0.0f, sumB = 0.0f;
+            for (int t = 0; t < 4; t++) {
+                const int32_t tx = ix + (t & 1);
+                const int32_t ty = iy + (t >> 1);
+                if (tx < 0 || ty < 0 || tx >= sw || ty >= sh) continue;
+
+                const float wgt = ((t & 1) ? fx : 1.0f - fx) * ((t >> 1) ? fy : 1.0f - fy);
+                const float wa  = wgt * (float)inA[ty * sw + tx];
+                if (wa <= 0.0f) continue;
+
+                const uint16_t c = inRgb[ty * sw + tx];
+                sumA += wa;
+                sumR += wa * (float)(c >> 11);
+                sumG += wa * (float)((c >> 5) & 0x3F);
+                sumB += wa * (float)(c & 0x1F);
+            }
+
+            const int32_t o = dy * w + dx;
+            if (sumA < 0.5f) {
+                outRgb[o] = 0;
+                outA[o]   = 0;
+                continue;
+            }
+            const uint16_t r = (uint16_t)(sumR / sumA + 0.5f);
+            const uint16_t g = (uint16_t)(sumG / sumA + 0.5f);
+            const uint16_t b = (uint16_t)(sumB / sumA + 0.5f);
+            outRgb[o] = (uint16_t)((r << 11) | (g << 5) | b);
+            outA[o]   = (uint8_t)(sumA > 255.0f ? 255.0f : sumA + 0.5f);
+        }
+    }
+
+    lv_image_cache_drop(&s.dsc);   // same descriptor, new pixels
+
+    memset(&s.dsc, 0, sizeof(s.dsc));
+    s.dsc.header.magic  = LV_IMAGE_HEADER_MAGIC;
+    s.dsc.header.cf     = LV_COLOR_FORMAT_RGB565A8;
+    s.dsc.header.w      = w;
+    s.dsc.header.h      = h;
+    s.dsc.header.stride = w * 2;
+    s.dsc.data_size     = size;
+    s.dsc.data          = s.data;
+
+    s.src     = src;
+    s.angle10 = angle10;
+    s.originX = x0;
+    s.originY = y0;
+    return true;
+}
+
+static int find_slot(const lv_image_dsc_t* src, int32_t angle10)
+{
+    for (int i = 0; i < NEEDLE_SPRITE_SLOTS; i++) {
+        if (g_slots[i].src == src && g_slots[i].angle10 == angle10) return i;
+    }
+    return -1;
+}
+
+// Least recently used slot that nobody is showing right now
+static int pick_victim()
+{
+    int best = -1;
+    for (int i = 0; i < NEEDLE_SPRITE_SLOTS; i++) {
+        if (g_slots[i].pins) continue;
+        if (!g_slots[i].src) return i;
+        if (best < 0 || g_slots[i].lastUse < g_slots[best].lastUse) best = i;
+    }
+    return best;
+}
+
+static NeedleHolder* holder_for(lv_obj_t* img)
+{
+    NeedleHolder* freeHolder = nullptr;
+    for (int i = 0; i < NEEDLE_SPRITE_HOLDERS; i++) {
+        if (g_holders[i].obj == img) return &g_holders[i];
+        if (!g_holders[i].obj && !freeHolder) freeHolder = &g_holders[i];
+    }
+    if (freeHolder) {
+        freeHolder->obj  = img;
+        freeHolder->slot = -1;
+    }
+    return freeHolder;
+}
+
+void needle_sprite_place(lv_obj_t* img, const lv_image_dsc_t* src,
+                         int32_t pivotX, int32_t pivotY,
+                         int32_t angle10, int32_t cx, int32_t cy)
+{
+    angle10 %= 3600;
+    if (angle10 < 0) angle10 += 3600;
+
+    NeedleHolder* holder = holder_for(img);
+    int slot = holder ? find_slot(src, angle10) : -1;
+
+    if (slot < 0 && holder) {
+        slot = pick_victim();
+        if (slot >= 0 && !render_slot(g_slots[slot], src, pivotX, pivotY, angle10)) {
+            g_slots[slot].src = nullptr;
+            slot = -1;
+        }
+    }
+
+    if (slot < 0) {
+        // Out of PSRAM/slots: fall back to LVGL rotating the original
+        static bool warned = false;
+        if (!warned) {
+            Serial.println("[Needle] sprite cache unavailable, using live rotation");
+            warned = true;
+        }
+        if (holder && holder->slot >= 0) g_slots[holder->slot].pins--;
+        if (holder) holder->slot = -1;
+        lv_image_set_src(img, src);
+        lv_image_set_pivot(img, pivotX, pivotY);
+        lv_image_set_rotation(img, angle10);
+        lv_obj_set_pos(img, cx - pivotX, cy - pivotY);
+        return;
+    }
+
+    NeedleSlot& s = g_slots[slot];
+    s.lastUse = ++g_useCounter;
+
+    if (holder->slot != slot) {
+        s.pins++;
+        if (holder->slot >= 0) g_slots[holder->slot].pins--;
+        holder->slot = (int8_t)slot;
+    }
+
+    lv_image_set_rotation(img, 0);
+    lv_image_set_src(img, &s.dsc);
+    lv_obj_set_pos(img, cx + s.originX, cy + s.originY);
+}
+
+void needle_sprites_reset()
+{
+    for (int i = 0; i < NEEDLE_SPRITE_HOLDERS; i++) {
+        g_holders[i].obj  = nullptr;
+        g_holders[i].slot = -1;
+    }
+    for (int i = 0; i < NEEDLE_SPRITE_SLOTS; i++) {
+        g_slots[i].pins = 0;
+    }
+}
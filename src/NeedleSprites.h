@@ -0,0 +1,25 @@
+#pragma once
+#include <lvgl.h>
+
+// Pre-rotated clock needle sprites.
+//
+// LVGL's image transform is one of the slowest software draw paths and it runs
+// on every redraw that touches a rotated needle. Instead we rotate the needle
+// bitmap once per angle (bilinear, so edges stay anti-aliased) into a small
+// PSRAM cache, and the needle object just blits the result untransformed.
+//
+// Sprites are built on first use and kept in a few LRU slots; a clock only
+// shows a handful of angles at once, so this stays cheap on memory while the
+// hour hand can still move in 0.5° steps.
+
+// Show `src` rotated by angle10 (0.1° units, clockwise, 0 = pointing right)
+// around pivot (pivotX, pivotY) of the source, with the pivot landing on
+// (cx, cy) in the parent's content coordinates. `img` must be an lv_image
+// with LV_ALIGN_TOP_LEFT. Source must be RGB565A8.
+void needle_sprite_place(lv_obj_t* img, const lv_image_dsc_t* src,
+                         int32_t pivotX, int32_t pivotY,
+                         int32_t angle10, int32_t cx, int32_t cy);
+
+// Forget which objects hold which sprite. Call when the needle objects
+// have been recreated (screen rebuilt).
+void needle_sprites_reset();
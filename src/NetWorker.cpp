@@ -0,0 +1,107 @@
+#include "NetWorker.h"
+#include <Arduino.h>
+#include "freertos/queue.h"
+
+struct NetJob {
+  NetJobKind kind;
+  NetJobFn   fn;
+};
+
+struct NetJobStats {
+  uint32_t runs;
+  uint32_t failures;
+  uint32_t lastMs;
+  uint32_t maxMs;
+};
+
+static const char* const kJobNames[NET_JOB_KIND_COUNT] = {
+  "ntp", "tide", "weather", "weather bg"
+};
+
+static TaskHandle_t  s_task   = nullptr;
+static QueueHandle_t s_jobs   = nullptr;
+static QueueHandle_t s_events = nullptr;
+static NetJobStats   s_stats[NET_JOB_KIND_COUNT];
+static volatile int8_t s_running = -1;   // kind in progress, -1 = idle
+
+static void net_task(void* arg)
+{
+  NetJob job;
+  for(;;) {
+    if(xQueueReceive(s_jobs, &job, portMAX_DELAY) != pdTRUE) continue;
+
+    s_running = (int8_t)job.kind;
+    const uint32_t t0 = millis();
+    const bool ok = job.fn ? job.fn() : false;
+    const uint32_t ms = millis() - t0;
+    s_running = -1;
+
+    NetJobStats& st = s_stats[job.kind];
+    st.runs++;
+    if(!ok) st.failures++;
+    st.lastMs = ms;
+    if(ms > st.maxMs) st.maxMs = ms;
+
+    // Room for every job that can be queued, but never block the worker on it
+    const NetJobEvent ev = { job.kind, ok, ms };
+    if(xQueueSend(s_events, &ev, 0) != pdTRUE) {
+      Serial.printf("[Net] event queue full, dropped %s\n", kJobNames[job.kind]);
+    }
+  }
+}
+
+void net_worker_begin(void)
+{
+  if(s_task) return;
+
+  s_jobs   = xQueueCreate(NET_WORKER_QUEUE_LEN, sizeof(NetJob));
+  s_events = xQueueCreate(NET_WORKER_QUEUE_LEN + 1, sizeof(NetJobEvent));
+  if(!s_jobs || !s_events) {
+    Serial.println("[Net] Failed to create queues");
+    return;
+  }
+
+  // Core 0 with the WiFi stack; lv_flush (priority 3) still preempts it
+  BaseType_t ok = xTaskCreatePinnedToCore(net_task, "net", NET_WORKER_STACK, nullptr, 1, &s_task, 0);
+  if(ok != pdPASS) {
+    Serial.println("[Net] Failed to create net task");
+    s_task = nullptr;
+  }
+}
+
+bool net_worker_post(NetJobKind kind, NetJobFn fn)
+{
+  if(!s_task || kind >= NET_JOB_KIND_COUNT) return false;
+  const NetJob job = { kind, fn };
+  if(xQueueSend(s_jobs, &job, 0) != pdTRUE) {
+    Serial.printf("[Net] job queue full, %s not queued\n", kJobNames[kind]);
+    return false;
+  }
+  return true;
+}
+
+bool net_worker_poll(NetJobEvent* out)
+{
+  if(!s_events || !out) return false;
+  return xQueueReceive(s_events, out, 0) == pdTRUE;
+}
+
+TaskHandle_t net_worker_task(void)
+{
+  return s_task;
+}
+
+void net_worker_dump(void)
+{
+  const int8_t running = s_running;
+  Serial.printf("[Net] %s, %u queued\n",
+                running < 0 ? "idle" : kJobNames[running],
+                s_jobs ? (unsigned)uxQueueMessagesWaiting(s_jobs) : 0u);
+  Serial.println("  job         runs  failed   last ms    max ms");
+  for(int i = 0; i < NET_JOB_KIND_COUNT; i++) {
+    const NetJobStats& st = s_stats[i];
+    Serial.printf("  %-10s %5lu  %6lu  %8lu  %8lu\n", kJobNames[i],
+                  (unsigned long)st.runs, (unsigned long)st.failures,
+                  (unsigned long)st.lastMs, (unsigned long)st.maxMs);
+  }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Network jobs off loopTask.
+//
+// NTP, the Stormglass HTTPS request, the OpenWeather GET and the LittleFS
+// writes that go with them take seconds, and on loopTask they froze key
+// handling, dimming and the sleep timers. loop() now posts jobs here; a task
+// pinned to core 0 (next to the WiFi stack) runs them one at a time, in order,
+// and posts a completion event back. loop() polls for those and does anything
+// that touches LVGL or the I2C bus (RTC) itself.
+//
+// Job functions run on the worker: no LVGL without lv_lock(), no I2C.
+
+enum NetJobKind : uint8_t {
+  NET_JOB_NTP = 0,
+  NET_JOB_TIDE,
+  NET_JOB_WEATHER,
+  NET_JOB_WEATHER_BG,   // background image prefetch, LittleFS only
+  NET_JOB_KIND_COUNT
+};
+
+typedef bool (*NetJobFn)(void);
+
+struct NetJobEvent {
+  NetJobKind kind;
+  bool       ok;        // what the job function returned
+  uint32_t   ms;        // how long it ran
+};
+
+#define NET_WORKER_STACK     8192   // TLS handshake is the deep part
+#define NET_WORKER_QUEUE_LEN 6
+
+void net_worker_begin(void);
+
+// Queue a job. False if the worker isn't running or the queue is full.
+bool net_worker_post(NetJobKind kind, NetJobFn fn);
+
+// Non-blocking, from loop(): next finished job, if any
+bool net_worker_poll(NetJobEvent* out);
+
+TaskHandle_t net_worker_task(void);   // for MemMonitor
+void net_worker_dump(void);
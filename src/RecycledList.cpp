@@ -0,0 +1,233 @@
+#include "RecycledList.h"
+#include <Arduino.h>
+#include <string.h>
+
+// Shared by every list; the states map to item flags in bind_row
+static lv_style_t s_rowStyle;      // default
+static lv_style_t s_savedStyle;    // LV_STATE_CHECKED   = RECYCLED_ITEM_SAVED
+static lv_style_t s_absentStyle;   // LV_STATE_USER_1    = RECYCLED_ITEM_ABSENT
+static lv_style_t s_headerStyle;   // LV_STATE_DISABLED  = RECYCLED_ITEM_HEADER
+static lv_style_t s_pressedStyle;
+static bool       s_stylesReady = false;
+
+static void init_styles(void)
+{
+  if(s_stylesReady) return;
+  s_stylesReady = true;
+
+  lv_style_init(&s_rowStyle);
+  lv_style_set_bg_opa(&s_rowStyle, LV_OPA_TRANSP);
+  lv_style_set_border_side(&s_rowStyle, LV_BORDER_SIDE_BOTTOM);
+  lv_style_set_border_width(&s_rowStyle, 1);
+  lv_style_set_border_color(&s_rowStyle, lv_color_hex(0xE0E0E0));
+  lv_style_set_radius(&s_rowStyle, 0);
+  lv_style_set_pad_all(&s_rowStyle, 0);
+  lv_style_set_text_color(&s_rowStyle, lv_color_hex(0x202020));
+
+  lv_style_init(&s_savedStyle);
+  lv_style_set_text_color(&s_savedStyle, lv_color_hex(0x41C7FF));
+
+  lv_style_init(&s_absentStyle);
+  lv_style_set_text_color(&s_absentStyle, lv_color_hex(0xAAAAAA));
+
+  lv_style_init(&s_headerStyle);
+  lv_style_set_text_color(&s_headerStyle, lv_color_hex(0x808080));
+  lv_style_set_bg_opa(&s_headerStyle, LV_OPA_TRANSP);
+
+  lv_style_init(&s_pressedStyle);
+  lv_style_set_bg_opa(&s_pressedStyle, LV_OPA_COVER);
+  lv_style_set_bg_color(&s_pressedStyle, lv_color_hex(0xDDF4FF));
+}
+
+static void set_state(lv_obj_t* obj, lv_state_t state, bool on)
+{
+  // Only touch the object when the state actually flips; each change restyles it
+  if(lv_obj_has_state(obj, state) == on) return;
+  if(on) lv_obj_add_state(obj, state);
+  else   lv_obj_remove_state(obj, state);
+}
+
+static void bind_row(RecycledList* list, RecycledListRow& row, int16_t index)
+{
+  if(index < 0 || index >= list->count) {
+    row.bound = -1;
+    lv_obj_add_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+    return;
+  }
+
+  const RecycledListItem& item = list->items[index];
+  row.bound = index;
+  lv_obj_set_y(row.obj, index * list->rowH);
+  lv_obj_remove_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+
+  // Static text: the label keeps a pointer into items[], no copy
+  lv_label_set_text_static(row.text, item.text);
+
+  if(item.rssi != 0 && !(item.flags & RECYCLED_ITEM_HEADER)) {
+    snprintf(row.rssiText, sizeof(row.rssiText), "%d", (int)item.rssi);
+    lv_label_set_text_static(row.rssi, row.rssiText);
+    lv_obj_remove_flag(row.rssi, LV_OBJ_FLAG_HIDDEN);
+  } else {
+    lv_obj_add_flag(row.rssi, LV_OBJ_FLAG_HIDDEN);
+  }
+
+  if(item.flags & RECYCLED_ITEM_LOCKED) lv_obj_remove_flag(row.lock, LV_OBJ_FLAG_HIDDEN);
+  else                                  lv_obj_add_flag(row.lock, LV_OBJ_FLAG_HIDDEN);
+
+  set_state(row.obj, LV_STATE_CHECKED,  item.flags & RECYCLED_ITEM_SAVED);
+  set_state(row.obj, LV_STATE_USER_1,   item.flags & RECYCLED_ITEM_ABSENT);
+  set_state(row.obj, LV_STATE_DISABLED, item.flags & RECYCLED_ITEM_HEADER);
+}
+
+// Rebind the pool so it covers the items under the viewport
+static void bind_from(RecycledList* list, int16_t first, bool force)
+{
+  const int16_t maxFirst = list->count > list->rowCount ? list->count - list->rowCount : 0;
+  if(first > maxFirst) first = maxFirst;
+  if(first < 0) first = 0;
+  if(!force && first == list->first) return;
+  list->first = first;
+
+  for(uint8_t i = 0; i < list->rowCount; i++) {
+    bind_row(list, list->rows[i], first + i);
+  }
+}
+
+static void scroll_cb(lv_event_t* e)
+{
+  RecycledList* list = (RecycledList*)lv_event_get_user_data(e);
+  bind_from(list, (int16_t)(lv_obj_get_scroll_y(list->obj) / list->rowH), false);
+}
+
+static void row_clicked_cb(lv_event_t* e)
+{
+  RecycledList* list = (RecycledList*)lv_event_get_user_data(e);
+  lv_obj_t* target = (lv_obj_t*)lv_event_get_current_target(e);
+  for(uint8_t i = 0; i < list->rowCount; i++) {
+    const RecycledListRow& row = list->rows[i];
+    if(row.obj != target) continue;
+    if(row.bound < 0) return;
+    const RecycledListItem& item = list->items[row.bound];
+    if(item.flags & RECYCLED_ITEM_HEADER) return;
+    if(list->onSelect) list->onSelect(list, &item);
+    return;
+  }
+}
+
+static void deleted_cb(lv_event_t* e)
+{
+  // Screen evicted or content_area cleaned: the rows are gone with it
+  RecycledList* list = (RecycledList*)lv_event_get_user_data(e);
+  list->obj = nullptr;
+  list->spacer = nullptr;
+  list->rowCount = 0;
+}
+
+lv_obj_t* recycled_list_create(RecycledList* list, lv_obj_t* parent, int32_t w, int32_t h,
+                               int32_t rowH, const char* icon, recycled_list_cb_t onSelect, void* user)
+{
+  init_styles();
+
+  list->icon     = icon;
+  list->onSelect = onSelect;
+  list->user     = user;
+  list->rowH     = rowH;
+  list->count    = 0;
+  list->first    = 0;
+
+  lv_obj_t* cont = lv_obj_create(parent);
+  lv_obj_set_size(cont, w, h);
+  lv_obj_set_style_pad_all(cont, 0, 0);
+  lv_obj_set_scroll_dir(cont, LV_DIR_VER);
+  lv_obj_set_scrollbar_mode(cont, LV_SCROLLBAR_MODE_AUTO);
+  list->obj = cont;
+
+  // Invisible, but its height is what LVGL scrolls over
+  list->spacer = lv_obj_create(cont);
+  lv_obj_remove_style_all(list->spacer);
+  lv_obj_remove_flag(list->spacer, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_size(list->spacer, 1, 0);
+
+  // Enough rows to cover the viewport while one scrolls partly out of view
+  uint32_t rows = (uint32_t)((h + rowH - 1) / rowH) + 1;
+  if(rows > RECYCLED_LIST_MAX_ROWS) rows = RECYCLED_LIST_MAX_ROWS;
+  list->rowCount = (uint8_t)rows;
+
+  const int32_t textX = icon ? 28 : 6;
+  for(uint8_t i = 0; i < list->rowCount; i++) {
+    RecycledListRow& row = list->rows[i];
+    row.bound = -1;
+    row.rssiText[0] = '\0';
+
+    row.obj = lv_obj_create(cont);
+    lv_obj_remove_style_all(row.obj);
+    lv_obj_add_style(row.obj, &s_rowStyle, 0);
+    lv_obj_add_style(row.obj, &s_savedStyle, LV_STATE_CHECKED);
+    lv_obj_add_style(row.obj, &s_absentStyle, LV_STATE_USER_1);
+    lv_obj_add_style(row.obj, &s_headerStyle, LV_STATE_DISABLED);
+    lv_obj_add_style(row.obj, &s_pressedStyle, LV_STATE_PRESSED);
+    lv_obj_set_size(row.obj, lv_pct(100), rowH);
+    lv_obj_remove_flag(row.obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(row.obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(row.obj, row_clicked_cb, LV_EVENT_CLICKED, list);
+
+    if(icon) {
+      lv_obj_t* sym = lv_label_create(row.obj);
+      lv_label_set_text_static(sym, icon);
+      lv_obj_align(sym, LV_ALIGN_LEFT_MID, 6, 0);
+    }
+
+    // Clip, not dots or scroll: both of those allocate when the text changes
+    row.text = lv_label_create(row.obj);
+    lv_label_set_long_mode(row.text, LV_LABEL_LONG_CLIP);
+    lv_obj_set_width(row.text, w - textX - 64);
+    lv_label_set_text_static(row.text, "");
+    lv_obj_align(row.text, LV_ALIGN_LEFT_MID, textX, 0);
+
+    row.rssi = lv_label_create(row.obj);
+    lv_label_set_text_static(row.rssi, row.rssiText);
+    lv_obj_align(row.rssi, LV_ALIGN_RIGHT_MID, -26, 0);
+
+    // No padlock in the built-in symbol font; a closed eye reads as "private"
+    row.lock = lv_label_create(row.obj);
+    lv_label_set_text_static(row.lock, LV_SYMBOL_EYE_CLOSE);
+    lv_obj_align(row.lock, LV_ALIGN_RIGHT_MID, -4, 0);
+    lv_obj_add_flag(row.lock, LV_OBJ_FLAG_HIDDEN);
+  }
+
+  lv_obj_add_event_cb(cont, scroll_cb, LV_EVENT_SCROLL, list);
+  lv_obj_add_event_cb(cont, deleted_cb, LV_EVENT_DELETE, list);
+  return cont;
+}
+
+void recycled_list_clear(RecycledList* list)
+{
+  list->count = 0;
+}
+
+bool recycled_list_add(RecycledList* list, const char* text, int8_t rssi, uint8_t flags)
+{
+  if(list->count >= RECYCLED_LIST_MAX_ITEMS) return false;
+  RecycledListItem& item = list->items[list->count++];
+  strncpy(item.text, text ? text : "", sizeof(item.text) - 1);
+  item.text[sizeof(item.text) - 1] = '\0';
+  item.rssi  = rssi;
+  item.flags = flags;
+  return true;
+}
+
+void recycled_list_refresh(RecycledList* list)
+{
+  if(!list->obj) return;
+
+  lv_obj_set_height(list->spacer, list->count * list->rowH);
+  lv_obj_update_layout(list->obj);
+
+  // A shorter list may leave the old scroll position past the end
+  const int32_t maxScroll = list->count * list->rowH - lv_obj_get_content_height(list->obj);
+  if(lv_obj_get_scroll_y(list->obj) > (maxScroll > 0 ? maxScroll : 0)) {
+    lv_obj_scroll_to_y(list->obj, maxScroll > 0 ? maxScroll : 0, LV_ANIM_OFF);
+  }
+
+  bind_from(list, (int16_t)(lv_obj_get_scroll_y(list->obj) / list->rowH), true);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <stdint.h>
+#include <lvgl.h>
+
+// Scrolling list that never creates or deletes rows after it's built.
+//
+// lv_list makes a button + labels per entry, so every Wi-Fi scan freed and
+// reallocated the lot. This keeps a pool of rows, just enough to cover the
+// viewport plus one, and rebinds them to items as the list scrolls or the data
+// changes. Items live in the struct, labels point at them with
+// lv_label_set_text_static, and state (saved/absent/header) is an LVGL state
+// bit with a pre-built style - so a refresh moves and relabels rows without
+// touching the LVGL heap.
+
+#define RECYCLED_LIST_MAX_ITEMS 24   // a busy scan rarely shows more
+#define RECYCLED_LIST_MAX_ROWS  8
+#define RECYCLED_LIST_TEXT_LEN  33   // 32-char SSID + NUL
+
+enum : uint8_t {
+  RECYCLED_ITEM_HEADER = 1 << 0,   // section title, not clickable
+  RECYCLED_ITEM_LOCKED = 1 << 1,   // needs a password
+  RECYCLED_ITEM_SAVED  = 1 << 2,   // highlighted
+  RECYCLED_ITEM_ABSENT = 1 << 3,   // greyed (saved but not in range, "no networks")
+};
+
+struct RecycledListItem {
+  char    text[RECYCLED_LIST_TEXT_LEN];
+  int8_t  rssi;     // dBm; 0 = don't show
+  uint8_t flags;
+};
+
+struct RecycledList;
+typedef void (*recycled_list_cb_t)(RecycledList* list, const RecycledListItem* item);
+
+struct RecycledListRow {
+  lv_obj_t* obj;
+  lv_obj_t* text;
+  lv_obj_t* rssi;
+  lv_obj_t* lock;
+  int16_t   bound;      // item index, -1 = hidden
+  char      rssiText[8];
+};
+
+struct RecycledList {
+  lv_obj_t*          obj;        // scroll container; NULL once LVGL deleted it
+  lv_obj_t*          spacer;     // sets the scroll height to count * rowH
+  const char*        icon;       // leading symbol on every row (static), or NULL
+  recycled_list_cb_t onSelect;
+  void*              user;
+  int32_t            rowH;
+  uint8_t            rowCount;
+  uint8_t            count;
+  int16_t            first;      // item index of the top row
+  RecycledListRow    rows[RECYCLED_LIST_MAX_ROWS];
+  RecycledListItem   items[RECYCLED_LIST_MAX_ITEMS];
+};
+
+// Builds the container and its row pool (the only allocations). w/h in px.
+lv_obj_t* recycled_list_create(RecycledList* list, lv_obj_t* parent, int32_t w, int32_t h,
+                               int32_t rowH, const char* icon, recycled_list_cb_t onSelect, void* user);
+
+// Fill with recycled_list_add, then recycled_list_refresh to show it
+void recycled_list_clear(RecycledList* list);
+bool recycled_list_add(RecycledList* list, const char* text, int8_t rssi, uint8_t flags);
+void recycled_list_refresh(RecycledList* list);
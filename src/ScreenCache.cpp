@@ -0,0 +1,200 @@
+#include "ScreenCache.h"
+#include "LvglHeap.h"
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+
+struct ScreenEntry {
+  lv_obj_t ** screen;
+  const char * name;
+  void (*init)(void);
+  void (*destroy)(void);   // NULL = pinned
+  uint32_t lastUsed;       // lv_tick at last load
+  uint32_t bytes;          // LVGL heap the last build took
+  uint16_t builds;
+  uint16_t evictions;
+};
+
+static ScreenEntry s_entries[SCREEN_CACHE_MAX];
+static uint8_t     s_count      = 0;
+static uint8_t     s_warm       = SCREEN_CACHE_WARM;
+static bool        s_dirty      = false;   // something was loaded since the last trim
+static uint32_t    s_lastCheck  = 0;
+
+static const uint32_t kCheckPeriodMs = 1000;
+
+static ScreenEntry * find_entry(lv_obj_t ** screen)
+{
+  for(uint8_t i = 0; i < s_count; i++) {
+    if(s_entries[i].screen == screen) return &s_entries[i];
+  }
+  return nullptr;
+}
+
+// Everything LVGL has allocated right now, both tiers
+static uint32_t lvgl_bytes(void)
+{
+  uint32_t total = 0;
+  for(int i = 0; i < LVGL_HEAP_TIER_COUNT; i++) {
+    LvglHeapTierStats s;
+    lvgl_heap_stats((LvglHeapTier)i, &s);
+    total += s.bytes;
+  }
+  return total;
+}
+
+static bool under_pressure(void)
+{
+  return heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) < SCREEN_CACHE_LOW_INTERNAL ||
+         heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < SCREEN_CACHE_LOW_PSRAM;
+}
+
+// Still on the panel: the active screen, or the one a load animation is fading out
+static bool in_use(lv_obj_t * scr)
+{
+  lv_display_t * disp = lv_display_get_default();
+  return scr == lv_display_get_screen_active(disp) || scr == lv_display_get_screen_prev(disp);
+}
+
+static void build(ScreenEntry & e)
+{
+  const uint32_t before = lvgl_bytes();
+  const uint32_t t0 = millis();
+  e.init();
+  const uint32_t after = lvgl_bytes();
+  e.bytes = after > before ? after - before : 0;
+  e.builds++;
+  if(e.builds > 1) {
+    Serial.printf("[Screens] rebuilt %s: %lu B in %lu ms\n",
+                  e.name, (unsigned long)e.bytes, (unsigned long)(millis() - t0));
+  }
+}
+
+static void evict(ScreenEntry & e)
+{
+  const uint32_t before = lvgl_bytes();
+  lv_obj_delete(*e.screen);
+  *e.screen = nullptr;
+  e.destroy();   // drop the widget pointers the screen code kept
+  const uint32_t after = lvgl_bytes();
+  e.evictions++;
+  Serial.printf("[Screens] evicted %s: freed %lu B\n",
+                e.name, (unsigned long)(before > after ? before - after : 0));
+}
+
+void screen_cache_register(lv_obj_t ** screen, const char * name,
+                           void (*init)(void), void (*destroy)(void), bool build_now)
+{
+  ScreenEntry * e = find_entry(screen);
+  if(!e) {
+    if(s_count >= SCREEN_CACHE_MAX) {
+      Serial.printf("[Screens] table full, %s not managed\n", name);
+      if(build_now && !*screen) init();
+      return;
+    }
+    e = &s_entries[s_count++];
+    *e = {};
+  }
+  e->screen  = screen;
+  e->name    = name;
+  e->init    = init;
+  e->destroy = destroy;
+
+  if(build_now && !*screen) {
+    build(*e);
+    e->lastUsed = lv_tick_get();
+  }
+}
+
+void screen_cache_ensure(lv_obj_t ** screen, void (*init)(void))
+{
+  ScreenEntry * e = find_entry(screen);
+  if(!e) {
+    if(!*screen) init();   // not managed: old behaviour
+    return;
+  }
+  if(!*screen) build(*e);
+  e->lastUsed = lv_tick_get();
+  s_dirty = true;
+}
+
+bool screen_cache_evict(lv_obj_t ** screen)
+{
+  if(!*screen) return false;
+  if(in_use(*screen)) {
+    Serial.println("[Screens] not deleting a screen that is still showing");
+    return false;
+  }
+
+  ScreenEntry * e = find_entry(screen);
+  if(e && e->destroy) {
+    evict(*e);
+  } else {
+    lv_obj_delete(*screen);
+    *screen = nullptr;
+  }
+  return true;
+}
+
+// Least recently used screen that can go right now, or NULL
+static ScreenEntry * pick_victim(void)
+{
+  ScreenEntry * victim = nullptr;
+  for(uint8_t i = 0; i < s_count; i++) {
+    ScreenEntry & e = s_entries[i];
+    if(!e.destroy || !*e.screen || in_use(*e.screen)) continue;
+    if(!victim || (int32_t)(e.lastUsed - victim->lastUsed) < 0) victim = &e;
+  }
+  return victim;
+}
+
+void screen_cache_tick(void)
+{
+  if(!s_dirty && lv_tick_elaps(s_lastCheck) < kCheckPeriodMs) return;
+  s_lastCheck = lv_tick_get();
+
+  // Evictable screens that are built but not on the panel
+  lv_obj_t * fading = lv_display_get_screen_prev(lv_display_get_default());
+  uint8_t idle = 0;
+  for(uint8_t i = 0; i < s_count; i++) {
+    const ScreenEntry & e = s_entries[i];
+    if(e.destroy && *e.screen && !in_use(*e.screen)) idle++;
+  }
+
+  while(idle > s_warm) {
+    ScreenEntry * v = pick_victim();
+    if(!v) break;
+    evict(*v);
+    idle--;
+  }
+
+  while(idle > 0 && under_pressure()) {
+    ScreenEntry * v = pick_victim();
+    if(!v) break;
+    Serial.println("[Screens] memory pressure");
+    evict(*v);
+    idle--;
+  }
+
+  // A screen still fading out gets another look once the animation is done
+  s_dirty = fading != nullptr;
+}
+
+void screen_cache_set_warm(uint8_t warm)
+{
+  s_warm = warm;
+  s_dirty = true;
+}
+
+void screen_cache_dump(void)
+{
+  Serial.printf("[Screens] warm %u, pressure %s\n", (unsigned)s_warm, under_pressure() ? "yes" : "no");
+  const uint32_t now = lv_tick_get();
+  for(uint8_t i = 0; i < s_count; i++) {
+    const ScreenEntry & e = s_entries[i];
+    Serial.printf("  %-9s %-8s %7lu B  builds %u  evicted %u  used %lu s ago\n",
+                  e.name,
+                  !e.destroy ? "pinned" : (*e.screen ? "built" : "evicted"),
+                  (unsigned long)e.bytes, (unsigned)e.builds, (unsigned)e.evictions,
+                  (unsigned long)((now - e.lastUsed) / 1000));
+  }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <lvgl.h>
+
+// Which screens stay built.
+//
+// Every screen used to be built in ui_init() and never freed. Now each one is
+// registered here with its init function and, if it can be rebuilt, a destroy
+// function that drops its widget pointers. Screens without one (Main, Clock,
+// Power) are pinned. The rest are built on first visit. The SCREEN_CACHE_WARM
+// most recently used stay warm and older ones are deleted. Under memory
+// pressure even the warm ones go, least recently used first. A rebuilt screen
+// takes its state from the managers again (WeatherGet(), currentSettings, ...).
+//
+// All calls need the LVGL lock.
+
+#define SCREEN_CACHE_MAX          8
+#define SCREEN_CACHE_WARM         1               // evictable screens kept besides the active one
+#define SCREEN_CACHE_LOW_INTERNAL (64 * 1024)     // internal free below this = pressure
+#define SCREEN_CACHE_LOW_PSRAM    (512 * 1024)    // PSRAM free below this = pressure
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// destroy == NULL pins the screen. build_now builds it immediately (boot screens).
+void screen_cache_register(lv_obj_t ** screen, const char * name,
+                           void (*init)(void), void (*destroy)(void), bool build_now);
+
+// Build the screen if it isn't (first visit or evicted) and mark it used.
+// _ui_screen_change() calls this before loading.
+void screen_cache_ensure(lv_obj_t ** screen, void (*init)(void));
+
+// Delete a screen now, through its destroy hook if registered. Refuses the
+// active screen and one still animating out.
+bool screen_cache_evict(lv_obj_t ** screen);
+
+// From the LVGL task, outside event handlers: evicts what the warm count and
+// memory pressure allow. Cheap when there's nothing to do.
+void screen_cache_tick(void);
+
+void screen_cache_set_warm(uint8_t warm);
+void screen_cache_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,77 @@
+#include "SerialConsole.h"
+#include <Arduino.h>
+#include <string.h>
+
+#define SERIAL_CONSOLE_MAX_CMDS 16
+#define SERIAL_CONSOLE_LINE_LEN 64
+
+struct SerialCommand {
+    const char*     name;
+    const char*     help;
+    SerialCommandFn fn;
+};
+
+static SerialCommand g_cmds[SERIAL_CONSOLE_MAX_CMDS];
+static uint8_t g_cmdCount = 0;
+
+static char g_line[SERIAL_CONSOLE_LINE_LEN];
+static uint8_t g_lineLen = 0;
+
+bool serial_console_register(const char* name, const char* help, SerialCommandFn fn) {
+    if (!name || !fn || g_cmdCount >= SERIAL_CONSOLE_MAX_CMDS) return false;
+    g_cmds[g_cmdCount++] = { name, help, fn };
+    return true;
+}
+
+static void print_help() {
+    Serial.println("[Console] commands:");
+    for (uint8_t i = 0; i < g_cmdCount; i++) {
+        Serial.printf("  %-10s %s\n", g_cmds[i].name, g_cmds[i].help ? g_cmds[i].help : "");
+    }
+}
+
+static void run_line(char* line) {
+    // Split "name args..."
+    while (*line == ' ') line++;
+    if (!*line) return;
+
+    char* args = strchr(line, ' ');
+    if (args) {
+        *args++ = '\0';
+        while (*args == ' ') args++;
+    } else {
+        args = line + strlen(line);
+    }
+
+    if (strcmp(line, "help") == 0) {
+        print_help();
+        return;
+    }
+
+    for (uint8_t i = 0; i < g_cmdCount; i++) {
+        if (strcmp(line, g_cmds[i].name) == 0) {
+            g_cmds[i].fn(args);
+            return;
+        }
+    }
+    Serial.printf("[Console] unknown command '%s' (try 'help')\n", line);
+}
+
+void serial_console_tick() {
+    while (Serial.available() > 0) {
+        const int c = Serial.read();
+        if (c < 0) break;
+
+        if (c == '\r' || c == '\n') {
+            if (g_lineLen == 0) continue;
+            g_line[g_lineLen] = '\0';
+            g_lineLen = 0;
+            run_line(g_line);
+            continue;
+        }
+
+        if (g_lineLen < SERIAL_CONSOLE_LINE_LEN - 1) {
+            g_line[g_lineLen++] = (char)c;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Tiny line-based command reader on the USB serial port.
+// Type a command name (plus optional args) and hit enter, e.g. "prof".
+// "help" lists everything that's registered.
+
+typedef void (*SerialCommandFn)(const char* args);
+
+// Register a command. name/help must stay valid (string literals).
+// Returns false if the table is full.
+bool serial_console_register(const char* name, const char* help, SerialCommandFn fn);
+
+// Call from loop(); non-blocking, reads whatever is in the RX buffer.
+void serial_console_tick();
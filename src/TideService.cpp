@@ -254,6 +254,135 @@ void TideService::recordSuccessfulFetch(time_t nowUtc) {
 }
 
 
+// -----------------------------------------------------------------------------
+// Streaming parse of the Stormglass response
+// -----------------------------------------------------------------------------
+
+struct TideParseCounts {
+    size_t seen           = 0;
+    size_t badTime        = 0;
+    size_t missingFields  = 0;
+    bool   foundData      = false;   // saw "data":[
+    bool   error          = false;   // element or separator didn't parse (timeout, truncated body)
+};
+
+// ISO8601 "2024-05-01T13:42:00+00:00" -> UTC epoch (ESP32 tz dance)
+static time_t parseIsoUtc(const char* timeStr)
+{
+    struct tm t = {};
+    if (sscanf(timeStr, "%4d-%2d-%2dT%2d:%2d:%2d",
+               &t.tm_year, &t.tm_mon, &t.tm_mday,
+               &t.tm_hour, &t.tm_min, &t.tm_sec) != 6) {
+        return 0;
+    }
+    t.tm_year -= 1900;
+    t.tm_mon  -= 1;
+
+    char* oldTZ = getenv("TZ");
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    time_t ts = mktime(&t);
+
+    if (oldTZ) {
+        setenv("TZ", oldTZ, 1);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+
+    return ts;
+}
+
+// Next non-whitespace char without consuming it; -1 if the stream times out
+static int peekNonSpace(Stream& stream)
+{
+    const uint32_t t0 = millis();
+    for (;;) {
+        int c = stream.peek();
+        if (c < 0) {
+            if (millis() - t0 > stream.getTimeout()) return -1;
+            delay(1);
+            continue;
+        }
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            stream.read();
+            continue;
+        }
+        return c;
+    }
+}
+
+// The body is {"data":[{...},{...}],"meta":{...}}. Rather than buffering it
+// and building a document for the lot, skip to data[] and deserialize one
+// element at a time through a filter that keeps type/time/height, reusing the
+// same document. meta (and anything after the extremes we have room for) is
+// never parsed. A body that stops short of the closing ] sets counts.error.
+static size_t parseExtremesStream(Stream& stream, TideState& outState, TideParseCounts& counts)
+{
+    if (!stream.find("\"data\"") || !stream.find("[")) return 0;
+    counts.foundData = true;
+
+    int c = peekNonSpace(stream);
+    if (c == ']') return 0;
+    if (c < 0) {
+        counts.error = true;
+        return 0;
+    }
+
+    JsonDocument filter;
+    filter["type"]   = true;
+    filter["time"]   = true;
+    filter["height"] = true;
+
+    JsonDocument obj;
+    size_t count = 0;
+    for (;;) {
+        obj.clear();
+        DeserializationError err = deserializeJson(obj, stream, DeserializationOption::Filter(filter));
+        if (err) {
+            Serial.printf("[TideService] JSON parse error in data[%u]: %s\n",
+                          static_cast<unsigned>(counts.seen), err.c_str());
+            counts.error = true;
+            break;
+        }
+        ++counts.seen;
+
+        const char* typeStr = obj["type"];   // "high" / "low"
+        const char* timeStr = obj["time"];   // ISO8601
+        float height = obj["height"] | 0.0f;
+
+        if (!typeStr || !timeStr) {
+            ++counts.missingFields;
+        } else {
+            time_t ts = parseIsoUtc(timeStr);
+            if (ts <= 0) {
+                ++counts.badTime;
+            } else {
+                TideExtreme& e = outState.extremes[count++];
+                e.timeUtc = ts;
+                e.height  = height;
+                e.isHigh  = (strcmp(typeStr, "high") == 0);
+            }
+        }
+
+        c = peekNonSpace(stream);
+        if (c == ']') break;
+        if (c != ',') {
+            Serial.printf("[TideService] data[] cut short after %u elements\n",
+                          static_cast<unsigned>(counts.seen));
+            counts.error = true;
+            break;
+        }
+        stream.read();
+
+        // Full: the rest of the array isn't needed
+        if (count >= TideState::MAX_EXTREMES) break;
+    }
+
+    return count;
+}
+
 TideUpdateResult TideService::update(uint16_t horizonHours, TideState& outState) {
     time_t nowUtc = time(nullptr);
     Serial.printf("[TideService] update() called at %ld (UTC), horizon=%u h\n",
@@ -329,6 +458,7 @@ url += "&datum=MSL";
     client.setInsecure(); // TODO: cert if you want full TLS verification
 
     HTTPClient https;
+    https.useHTTP10(true);   // no chunked encoding, so getStream() is the raw JSON
     if (!https.begin(client, url)) {
         Serial.println("[TideService] https.begin() failed");
         return TideUpdateResult::NetworkError;
@@ -345,82 +475,32 @@ url += "&datum=MSL";
         return TideUpdateResult::HttpError;
     }
 
-    String payload = https.getString();
-    https.end();
+    Serial.printf("[TideService] Payload size: %d bytes (streamed)\n", https.getSize());
 
-    Serial.printf("[TideService] Payload size: %u bytes\n",
-                  static_cast<unsigned>(payload.length()));
+    // Parse into a scratch state so a failed body leaves outState as it was
+    TideState parsed;
+    TideParseCounts counts;
+    size_t count = parseExtremesStream(https.getStream(), parsed, counts);
+    https.end();
 
-    StaticJsonDocument<8 * 1024> doc;
-    DeserializationError err = deserializeJson(doc, payload);
-    if (err) {
-        Serial.print("[TideService] JSON parse error: ");
-        Serial.println(err.c_str());
+    if (!counts.foundData) {
+        Serial.println("[TideService] No data[] array in JSON");
         return TideUpdateResult::ParseError;
     }
-
-    JsonArray data = doc["data"].as<JsonArray>();
-    if (data.isNull()) {
-        Serial.println("[TideService] No data[] array in JSON");
+    if (counts.error) {
+        // Truncated or timed out: don't cache it or start the 3h cooldown
         return TideUpdateResult::ParseError;
     }
-
-    Serial.printf("[TideService] JSON data[] size: %u\n",
-                  static_cast<unsigned>(data.size()));
-
-    size_t count = 0;
-    size_t skippedBadTime       = 0;
-    size_t skippedMissingFields = 0;
-
-    for (JsonObject obj : data) {
-        if (count >= TideState::MAX_EXTREMES) break;
-
-        const char* typeStr = obj["type"];   // "high" / "low"
-        const char* timeStr = obj["time"];   // ISO8601
-        float height = obj["height"] | 0.0f;
-
-        if (!typeStr || !timeStr) {
-            ++skippedMissingFields;
-            continue;
-        }
-
-        struct tm t = {};
-        if (sscanf(timeStr, "%4d-%2d-%2dT%2d:%2d:%2d",
-                   &t.tm_year, &t.tm_mon, &t.tm_mday,
-                   &t.tm_hour, &t.tm_min, &t.tm_sec) != 6) {
-            ++skippedBadTime;
-            continue;
-        }
-        t.tm_year -= 1900;
-        t.tm_mon  -= 1;
-
-        // Convert ISO8601 to epoch in UTC (ESP32 tz dance)
-        char* oldTZ = getenv("TZ");
-        setenv("TZ", "UTC0", 1);
-        tzset();
-
-        time_t ts = mktime(&t);
-
-        if (oldTZ) {
-            setenv("TZ", oldTZ, 1);
-        } else {
-            unsetenv("TZ");
-        }
-        tzset();
-
-        if (ts <= 0) {
-            ++skippedBadTime;
-            continue;
-        }
-
-        TideExtreme& e = outState.extremes[count++];
-        e.timeUtc = ts;
-        e.height  = height;
-        e.isHigh  = (strcmp(typeStr, "high") == 0);
+    if (counts.seen == 0) {
+        Serial.println("[TideService] Empty data[] array");
+        return TideUpdateResult::ParseError;
     }
 
-   outState.count        = count;
-outState.fetchedAtUtc = nowUtc;
+    const size_t skippedBadTime       = counts.badTime;
+    const size_t skippedMissingFields = counts.missingFields;
+
+   parsed.count        = count;
+parsed.fetchedAtUtc = nowUtc;
 
 Serial.printf("[TideService] Parsed %u extremes (skipped: badTime=%u, missing=%u)\n",
               static_cast<unsigned>(count),
@@ -432,6 +512,8 @@ if (count < 2) {
     return TideUpdateResult::ParseError;
 }
 
+outState = parsed;
+
 // Keep using Preferences for rate-limiting
 recordSuccessfulFetch(nowUtc);
 
@@ -0,0 +1,40 @@
+#include "WeatherManager.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+// Formatting for WeatherData, kept out of WeatherManager.cpp so the screens
+// (and the host bench) can use it without the network code.
+
+const char* weather_format_temp(const WeatherData& wd, char* buf, size_t len)
+{
+    if (isnan(wd.temperatureC)) snprintf(buf, len, "N/A");
+    else snprintf(buf, len, "%.1f°C", wd.temperatureC);
+    return buf;
+}
+
+const char* weather_format_wind(const WeatherData& wd, char* buf, size_t len)
+{
+    snprintf(buf, len, "%.1f m/s", wd.windSpeed);
+    return buf;
+}
+
+const char* weather_format_humidity(const WeatherData& wd, char* buf, size_t len)
+{
+    snprintf(buf, len, "%u%%", (unsigned)wd.humidity);
+    return buf;
+}
+
+const char* weather_format_clock(uint32_t epoch, char* buf, size_t len)
+{
+    if (!epoch) {
+        snprintf(buf, len, "--:--");
+        return buf;
+    }
+    // Same offset strTime() applies
+    time_t t = (time_t)epoch + TIME_OFFSET;
+    struct tm tmv;
+    localtime_r(&t, &tmv);
+    snprintf(buf, len, "%02d:%02d", tmv.tm_hour, tmv.tm_min);
+    return buf;
+}
@@ -0,0 +1,17 @@
+#include "WeatherIcons.h"
+#include "ImageCache.h"
+#include "AssetManifest.h"
+
+void weather_icon_show(lv_obj_t* img, WeatherIcon icon)
+{
+  if(!img) return;
+  if(icon >= WEATHER_ICON_COUNT) icon = WEATHER_ICON_UNKNOWN;
+
+  if(!lv_image_get_src(img)) {
+    ImageCache::instance().setSrc(img, asset_path(ASSET_ICONS_ATLAS));
+    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_TOP_LEFT);
+  }
+
+  const int32_t y = -(int32_t)icon * WEATHER_ICON_SIZE;
+  if(lv_image_get_offset_y(img) != y) lv_image_set_offset_y(img, y);
+}
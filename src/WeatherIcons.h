@@ -0,0 +1,60 @@
+#pragma once
+#include <stdint.h>
+#include <lvgl.h>
+
+// Weather condition icons, packed into one atlas by scripts/lvgl_assets.py:
+// 32x32 cells stacked top to bottom in a single RGB565A8 image. The icon
+// image shows the whole atlas shifted up by cell * 32, clipped to one cell,
+// so changing the icon only changes an offset - the source never changes.
+
+#define WEATHER_ICON_SIZE  32   // atlas: ASSET_ICONS_ATLAS
+
+// Atlas cell. Order must match the "lvgl/icons/atlas.bin" entry in ATLASES
+// in scripts/lvgl_assets.py.
+enum WeatherIcon : uint8_t {
+  WEATHER_ICON_CLEAR_DAY,
+  WEATHER_ICON_CLEAR_NIGHT,
+  WEATHER_ICON_CLOUDY,
+  WEATHER_ICON_DRIZZLE,
+  WEATHER_ICON_FOG,
+  WEATHER_ICON_LIGHT_RAIN,
+  WEATHER_ICON_PARTLY_CLOUDY_DAY,
+  WEATHER_ICON_PARTLY_CLOUDY_NIGHT,
+  WEATHER_ICON_RAIN,
+  WEATHER_ICON_SLEET,
+  WEATHER_ICON_SNOW,
+  WEATHER_ICON_THUNDERSTORM,
+  WEATHER_ICON_UNKNOWN,
+  WEATHER_ICON_COUNT
+};
+
+// OpenWeather condition id (+ night) -> atlas cell
+constexpr WeatherIcon weather_icon_for(uint16_t id, bool night)
+{
+  return (id / 100 == 2)                ? WEATHER_ICON_THUNDERSTORM
+       : (id / 100 == 3)                ? WEATHER_ICON_DRIZZLE
+       : (id == 500)                    ? WEATHER_ICON_LIGHT_RAIN
+       : (id == 511)                    ? WEATHER_ICON_SLEET
+       : (id / 100 == 5)                ? WEATHER_ICON_RAIN
+       : (id >= 611 && id <= 616)       ? WEATHER_ICON_SLEET
+       : (id / 100 == 6)                ? WEATHER_ICON_SNOW
+       : (id / 100 == 7)                ? WEATHER_ICON_FOG
+       : (id == 800)                    ? (night ? WEATHER_ICON_CLEAR_NIGHT : WEATHER_ICON_CLEAR_DAY)
+       : (id == 801)                    ? (night ? WEATHER_ICON_PARTLY_CLOUDY_NIGHT : WEATHER_ICON_PARTLY_CLOUDY_DAY)
+       : (id >= 802 && id <= 804)       ? WEATHER_ICON_CLOUDY
+       :                                  WEATHER_ICON_UNKNOWN;
+}
+
+static_assert(weather_icon_for(800, true) == WEATHER_ICON_CLEAR_NIGHT, "weather icon table");
+static_assert(weather_icon_for(615, false) == WEATHER_ICON_SLEET, "weather icon table");
+static_assert(weather_icon_for(666, false) == WEATHER_ICON_UNKNOWN, "weather icon table");
+
+// OpenWeather icon codes end in 'd' or 'n' ("04n")
+constexpr bool weather_icon_code_is_night(const char* code)
+{
+  return code && code[0] && code[1] && code[2] == 'n';
+}
+
+// Point an lv_image (sized WEATHER_ICON_SIZE square) at one atlas cell.
+// First call binds the atlas; after that it's just an offset. LVGL lock held.
+void weather_icon_show(lv_obj_t* img, WeatherIcon icon);
@@ -5,6 +5,7 @@
 #include <Arduino.h>
 #include <Time.h>
 #include "WeatherManager.h"
+#include "WeatherIcons.h"
 #include "ui.h"
 #include <ArduinoJson.h>
 #include <LittleFS.h>
@@ -12,12 +13,14 @@
 #include <NTPClient.h>
 #include <HTTPClient.h>
 #include "esp_heap_caps.h"
+#include "LvglHeap.h"
+#include "MemMonitor.h"
 // Tide imports
 #include "TideService.h"
 
 // DEFINES //
 
-#define TIME_OFFSET 1UL * 3600UL // UTC + 0 hour
+// TIME_OFFSET lives in WeatherManager.h (shared with WeatherFormat.cpp)
 
 
 
@@ -55,6 +58,15 @@ static TideService g_tideService(STORMGLASS_API_KEY,
                                  longitude.toDouble());
 static TideState g_tideState;
 
+// The NetWorker jobs fill these; loop() copies them into currentWeatherData /
+// g_tideState (WeatherCommit*) once the job's completion event arrives, so the
+// UI never reads a struct the worker is halfway through writing.
+static WeatherData s_weatherStage;
+static volatile bool s_weatherStaged = false;
+static TideState s_tideStage;
+static volatile bool s_tideStaged = false;
+static volatile bool s_tideStageFresh = false;   // a real fetch, not the cache
+
 
 // Main part starts here //
 OW_Weather ow; // Weather forecast library instance
@@ -79,67 +91,99 @@ static void log_heap_detailed(const char* tag)
                   (unsigned)freeInternal, (unsigned)largestInternal);
     Serial.printf("  PSRAM:          free=%u, largest=%u\n",
                   (unsigned)freePsram, (unsigned)largestPsram);
+    lvgl_heap_dump("LVGL share");
 }
 
 
-bool WeatherUpdate()
+bool WeatherSyncTime()
 {
-    // REQUIREMENT: caller ensured WiFi is connected.
     if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("[Weather] No WiFi; skipping update.");
+        Serial.println("[Weather] No WiFi; skipping NTP.");
         return false;
     }
 
-    // ---- NTP sync (keep your existing NTPClient object) ----
     Serial.println("[Weather] Initializing NTP...");
     timeClient.begin();
 
     if (!timeClient.update()) {
         Serial.println("[Weather] Failed to get time from NTP server.");
-    } else {
-        time_t currentTime = timeClient.getEpochTime();
-        struct timeval tv = { .tv_sec = currentTime, .tv_usec = 0 };
-        settimeofday(&tv, nullptr);
+        return false;
+    }
 
-        g_ntpEpoch = currentTime;
-        g_ntpSynced = true;
+    time_t currentTime = timeClient.getEpochTime();
+    struct timeval tv = { .tv_sec = currentTime, .tv_usec = 0 };
+    settimeofday(&tv, nullptr);
 
-        Serial.printf("[Weather] Time synchronized with NTP: %s\n", ctime(&currentTime));
-    }
+    g_ntpEpoch = currentTime;
+    g_ntpSynced = true;
+
+    Serial.printf("[Weather] Time synchronized with NTP: %s\n", ctime(&currentTime));
+    return true;
+}
 
-   
+bool WeatherFetchTides()
+{
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("[Tide] No WiFi; skipping update.");
+        return false;
+    }
 
     log_heap_detailed("TideService: before HTTPS");
 
-
-    // ---- tide logic ----
+    // Start from what the UI has, so a skipped or failed fetch changes nothing
     constexpr uint16_t TIDE_HORIZON_HOURS = 48;
-    TideUpdateResult tr = g_tideService.update(TIDE_HORIZON_HOURS, g_tideState);
+    s_tideStage = g_tideState;
+    TideUpdateResult tr;
+    {
+        MemPhaseScope phase(MemPhase::TideFetch);
+        tr = g_tideService.update(TIDE_HORIZON_HOURS, s_tideStage);
+    }
 
     switch (tr) {
         case TideUpdateResult::Ok:
             Serial.println("[Tide] Tide data updated.");
-             WeatherManager_MarkTideCurveDirty();   // ✅ tell the UI "new curve ready"
             break;
         case TideUpdateResult::SkippedRateLimit:
-            // Normal; we’re still inside the 3h cooldown
+            // Normal; we’re still inside the 3h cooldown (state comes from tide.json)
             break;
         case TideUpdateResult::TimeNotReady:
             Serial.println("[Tide] Time not ready yet, skipping tide update.");
-            break;
+            return false;
         case TideUpdateResult::NetworkError:
         case TideUpdateResult::HttpError:
         case TideUpdateResult::ParseError:
             Serial.printf("[Tide] Tide update failed (%d)\n", (int)tr);
-            break;
+            return false;
     }
-    // ---- tide logic ends ----
 
+    s_tideStageFresh = (tr == TideUpdateResult::Ok);
+    s_tideStaged = true;
+    return true;
+}
+
+bool WeatherFetchCurrent()
+{
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("[Weather] No WiFi; skipping update.");
+        return false;
+    }
+    return initializeWeatherData();
+}
 
-    // ---- your existing weather logic ----
-    initializeWeatherData();
-    // If your initializeWeatherData() doesn’t actually fetch new weather, and you have
-    // a separate fetch function, call it here instead.
+bool WeatherCommitCurrent()
+{
+    if (!s_weatherStaged) return false;
+    currentWeatherData = s_weatherStage;
+    s_weatherStaged = false;
+    return true;
+}
+
+bool WeatherCommitTides()
+{
+    if (!s_tideStaged) return false;
+    g_tideState = s_tideStage;
+    s_tideStaged = false;
+    if (s_tideStageFresh) WeatherManager_MarkTideCurveDirty();   // tell the UI "new curve ready"
     return true;
 }
 
@@ -150,14 +194,15 @@ void saveWeatherDataToFile(const char* filePath, const WeatherData& weather) {
         return;
     }
 
-    DynamicJsonDocument doc(512); // Adjust size as needed
+    JsonDocument doc;
 
-    doc["temperature"] = weather.temperature;
-    doc["condition"] = weather.condition;
-    doc["icon"] = weather.icon;
+    // Numbers go in as numbers; const char* text is stored by pointer, not copied
+    if (!isnan(weather.temperatureC)) doc["temp_c"] = weather.temperatureC;
+    doc["condition"] = (const char*)weather.condition;
+    doc["icon"] = (const char*)weather.icon;
     doc["sunrise"] = weather.sunrise;
     doc["sunset"] = weather.sunset;
-    doc["wind_speed"] = weather.wind_speed;
+    doc["wind_ms"] = weather.windSpeed;
     doc["humidity"] = weather.humidity;
     doc["lastUpdate"] = weather.lastUpdate;
     doc["id"] = weather.id;
@@ -178,7 +223,7 @@ bool loadWeatherDataFromFile(const char* filePath, WeatherData& weather) {
         return false;
     }
 
-    DynamicJsonDocument doc(512); // Adjust size as needed
+    JsonDocument doc;
 
     DeserializationError error = deserializeJson(doc, file);
     if (error) {
@@ -188,14 +233,22 @@ bool loadWeatherDataFromFile(const char* filePath, WeatherData& weather) {
         return false;
     }
 
-    weather.temperature = doc["temperature"].as<String>();
-    weather.condition = doc["condition"].as<String>();
-    weather.icon = doc["icon"].as<String>();
-    weather.sunrise = doc["sunrise"].as<String>();
-    weather.sunset = doc["sunset"].as<String>();
-    weather.wind_speed = doc["wind_speed"].as<String>();
-    weather.humidity = doc["humidity"].as<String>();
-    weather.moonphase = doc["moonphase"].as<String>();
+    // Files from before the numeric model have "temperature" as text;
+    // treat them as missing so the next update refetches
+    if (!doc["wind_ms"].is<float>()) {
+        Serial.println("Weather file is in the old format, ignoring it");
+        file.close();
+        return false;
+    }
+
+    weather.temperatureC = doc["temp_c"] | NAN;
+    strlcpy(weather.condition, doc["condition"] | "Unknown", sizeof(weather.condition));
+    strlcpy(weather.icon, doc["icon"] | "", sizeof(weather.icon));
+    weather.sunrise = doc["sunrise"] | 0u;
+    weather.sunset = doc["sunset"] | 0u;
+    weather.windSpeed = doc["wind_ms"] | 0.0f;
+    weather.humidity = doc["humidity"] | 0;
+    weather.moonphase = doc["moonphase"] | 0.0f;
     weather.lastUpdate = doc["lastUpdate"].as<unsigned long>();
     weather.id = doc["id"].as<uint16_t>(); 
     weather.dt = doc["dt"].as<unsigned long>();
@@ -205,21 +258,15 @@ bool loadWeatherDataFromFile(const char* filePath, WeatherData& weather) {
     return true;
 }
 
-void initializeWeatherData() {
+bool initializeWeatherData() {
     const char* filePath = "/weather.json";
 
     if (!LittleFS.exists(filePath)) {
         Serial.printf("File %s does not exist. Creating a default file.\n", filePath);
 
-        WeatherData defaultWeather;
-        defaultWeather.temperature = "N/A";
-        defaultWeather.condition = "Unknown";
-        defaultWeather.icon = "unknown";
-        defaultWeather.sunrise = "N/A";
-        defaultWeather.sunset = "N/A";
-        defaultWeather.wind_speed = "0";
-        defaultWeather.humidity = "0";
-        defaultWeather.moonphase = "0";
+        WeatherData defaultWeather = {};
+        defaultWeather.temperatureC = NAN;
+        strlcpy(defaultWeather.condition, "Unknown", sizeof(defaultWeather.condition));
         defaultWeather.lastUpdate = 0;
         defaultWeather.id = 666;
 
@@ -236,97 +283,85 @@ void initializeWeatherData() {
         saveWeatherDataToFile(filePath, defaultWeather);
        // printCurrentWeather();
     }
-    updateWeatherData();
+    return updateWeatherData();
 }
 
 
-void updateWeatherData() {
+// Runs on the net worker: fills s_weatherStage, never touches LVGL.
+// loop() applies it to the UI after WeatherCommitCurrent().
+bool updateWeatherData() {
+    WeatherData& stage = s_weatherStage;
+
     // Get the current time from the system
     time_t currentTime = time(nullptr);
 
     if (currentTime == -1) {
         Serial.println("Failed to get system time. Skipping weather update.");
-        return;  // Exit if the system time is not available
+        return false;  // Exit if the system time is not available
     }
 
     // Load weather data from file
-    if (!loadWeatherDataFromFile("/weather.json", currentWeatherData)) {
+    if (!loadWeatherDataFromFile("/weather.json", stage)) {
         Serial.println("Failed to load weather data. Initializing defaults.");
-        currentWeatherData.dt = 0;  // Force fetch on first run
+        stage.dt = 0;  // Force fetch on first run
     }
 
     // Print current and last update times for debugging
     Serial.printf("Current time (UNIX): %ld\n", currentTime);
-    Serial.printf("Weather data timestamp (UNIX): %ld\n", currentWeatherData.dt);
-    Serial.printf("Time since last update (seconds): %ld\n", currentTime - currentWeatherData.dt);
+    Serial.printf("Weather data timestamp (UNIX): %ld\n", stage.dt);
+    Serial.printf("Time since last update (seconds): %ld\n", currentTime - stage.dt);
 
     // Check if the weather data needs to be updated
-    if (currentWeatherData.dt == 0 || (currentTime - currentWeatherData.dt) >= 360) {
+    if (stage.dt == 0 || (currentTime - stage.dt) >= 360) {
         Serial.println("Fetching new weather data...");
 
         // Fetch new weather data
         //printCurrentWeather();
 
         // Update `dt` with the current system time
-        //currentWeatherData.dt = static_cast<unsigned long>(currentTime);
+        //stage.dt = static_cast<unsigned long>(currentTime);
 
         // Save updated weather data to file
         Serial.printf("Free heap: %u, largest block: %u\n",
               esp_get_free_heap_size(),
               heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
-        if (!fetchCurrentWeatherHTTP(currentWeatherData)) {
+        if (!fetchCurrentWeatherHTTP(stage)) {
     Serial.println("[Weather] fetchCurrentWeatherHTTP failed");
-    return;
+    return false;
 }
 
-        saveWeatherDataToFile("/weather.json", currentWeatherData); 
+        saveWeatherDataToFile("/weather.json", stage); 
     }
 
     else {
         Serial.println("Weather data is up-to-date. Skipping fetch.");
-         if (!loadWeatherDataFromFile("/weather.json", currentWeatherData)) {
+         if (!loadWeatherDataFromFile("/weather.json", stage)) {
         Serial.println("Failed to load weather data from file. Initializing defaults.");
-        currentWeatherData.dt = 0;  // Force fetch on first run
+        stage.dt = 0;  // Force fetch on first run
          //printCurrentWeather();
 
         // Update `dt` with the current system time
-        //currentWeatherData.dt = static_cast<unsigned long>(currentTime);
+        //stage.dt = static_cast<unsigned long>(currentTime);
 
         Serial.printf("Free heap: %u, largest block: %u\n",
               esp_get_free_heap_size(),
               heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
-        if (!fetchCurrentWeatherHTTP(currentWeatherData)) {
+        if (!fetchCurrentWeatherHTTP(stage)) {
     Serial.println("[Weather] fetchCurrentWeatherHTTP failed");
-    return;
+    return false;
 }
 
         // Save updated weather data to file
-        saveWeatherDataToFile("/weather.json", currentWeatherData); 
+        saveWeatherDataToFile("/weather.json", stage); 
     }
   }
     
-    Serial.println("Setting current Weather Data to display:");
-
-    // Update the UI with current weather data
-    lv_label_set_text(ui_WeatherLabel, currentWeatherData.temperature.c_str());
-
-    // Get the file path for the icon
-    const char* iconPath = getMeteoconIcon(currentWeatherData.id, true);
-    Serial.printf("Icon path: %s\n", iconPath);
-
-    // Update the weather icon on the UI
-    lv_img_set_src(ui_WeatherImage, iconPath);
-  //  lv_color_t sci_fi_blue = lv_color_make(0, 200, 255); // Cyan blue color
-   // lv_obj_set_style_img_recolor(ui_WeatherImage, sci_fi_blue, LV_PART_MAIN);
-   // lv_obj_set_style_img_recolor_opa(ui_WeatherImage, LV_OPA_90, LV_PART_MAIN);
+    s_weatherStaged = true;
 
-    Serial.println("Weather UI updated. Now doing a sanity check on the data currently held");
-
-    Serial.printf("[UI] Setting temp label from currentWeatherData.temperature='%s' id=%u\n",
-              currentWeatherData.temperature.c_str(), currentWeatherData.id);
-
-   
-    
+    char tempText[16];
+    weather_format_temp(stage, tempText, sizeof(tempText));
+    Serial.printf("[Weather] Staged temp='%s' id=%u\n", tempText, stage.id);
+    return true;
 }
 
 /***************************************************************************************
@@ -341,36 +376,6 @@ String strTime(time_t unixTime)
 
 
 
-const char* getMeteoconIcon(uint16_t id, bool today)
-{
-    if (today && id / 100 == 8 && (currentWeatherData.sunrise < currentWeatherData.sunset)) id += 1000; 
-    if (id == 666) {
-    return "A:/lvgl/icons/unknown.png";
-}
-    if (id / 100 == 2) return "A:/lvgl/icons/thunderstorm.png";
-    if (id / 100 == 3) return "A:/lvgl/icons/drizzle.png";
-    if (id / 100 == 4) return "A:/lvgl/icons/unknown.png";
-    if (id == 500) return "A:/lvgl/icons/light-rain.png";
-    else if (id == 511) return "A:/lvgl/icons/sleet.png";
-    else if (id / 100 == 5) return "A:/lvgl/icons/rain.png";
-    if (id >= 611 && id <= 616) return "A:/lvgl/icons/sleet.png";
-    else if (id / 100 == 6) return "A:/lvgl/icons/snow.png";
-    if (id / 100 == 7) return "A:/lvgl/icons/fog.png";
-    if (id == 800) return "A:/lvgl/icons/clear-day.png";
-    if (id == 801) return "A:/lvgl/icons/partly-cloudy-day.png";
-    if (id == 802) return "A:/lvgl/icons/cloudy.png";
-    if (id == 803) return "A:/lvgl/icons/cloudy.png";
-    if (id == 804) return "A:/lvgl/icons/cloudy.png";
-    if (id == 1800) return "A:/lvgl/icons/clear-night.png";
-    if (id == 1801) return "A:/lvgl/icons/partly-cloudy-night.png";
-    if (id == 1802) return "A:/lvgl/icons/cloudy.png";
-    if (id == 1803) return "A:/lvgl/icons/cloudy.png";
-    if (id == 1804) return "A:/lvgl/icons/cloudy.png";
-    return "A:/lvgl/icons/unknown.png";
-}
-
-
-
 void printCurrentWeather()
 {
   // Create the structures that hold the retrieved weather
@@ -426,13 +431,13 @@ void printCurrentWeather()
 
     Serial.println();
 
-    currentWeatherData.temperature = String(current->temp, 1) + "°C";
-        currentWeatherData.condition = current->description;
-        currentWeatherData.icon = current->icon;
-        currentWeatherData.sunrise = strTime(current->sunrise);
-        currentWeatherData.sunset = strTime(current->sunset);
-        currentWeatherData.wind_speed = String(current->wind_speed, 1) + " m/s";
-        currentWeatherData.humidity = String(current->humidity) + "%";
+    currentWeatherData.temperatureC = current->temp;
+        strlcpy(currentWeatherData.condition, current->description.c_str(), sizeof(currentWeatherData.condition));
+        strlcpy(currentWeatherData.icon, current->icon.c_str(), sizeof(currentWeatherData.icon));
+        currentWeatherData.sunrise = (uint32_t)current->sunrise;
+        currentWeatherData.sunset = (uint32_t)current->sunset;
+        currentWeatherData.windSpeed = current->wind_speed;
+        currentWeatherData.humidity = (uint8_t)current->humidity;
         currentWeatherData.id = uint16_t (current->id);
         currentWeatherData.dt = (current->dt);
 
@@ -559,8 +564,10 @@ static bool fetchCurrentWeatherHTTP(WeatherData& out)
 {
     if (WiFi.status() != WL_CONNECTED) return false;
 
+    MemPhaseScope phase(MemPhase::WeatherFetch);
     WiFiClient client;
     HTTPClient http;
+    http.useHTTP10(true);   // no chunked encoding, so getStream() is the raw JSON
 
     // Build URL: current weather
     String url = "http://api.openweathermap.org/data/2.5/weather?lat=" + latitude +
@@ -581,9 +588,22 @@ static bool fetchCurrentWeatherHTTP(WeatherData& out)
         return false;
     }
 
-    // Stream parse (NO big payload String)
-    StaticJsonDocument<2048> doc;
-    DeserializationError err = deserializeJson(doc, http.getStream());
+    // Stream parse through a filter: only the fields below are kept, the rest
+    // of the response (coord, base, clouds, name, ...) is skipped as it arrives,
+    // so the (heap) document only ever holds these few values
+    JsonDocument filter;
+    filter["dt"] = true;
+    filter["main"]["temp"] = true;
+    filter["main"]["humidity"] = true;
+    filter["wind"]["speed"] = true;
+    filter["sys"]["sunrise"] = true;
+    filter["sys"]["sunset"] = true;
+    filter["weather"][0]["id"] = true;            // [0] applies to every element
+    filter["weather"][0]["description"] = true;
+    filter["weather"][0]["icon"] = true;
+
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
     http.end();
 
     if (err) {
@@ -596,16 +616,17 @@ static bool fetchCurrentWeatherHTTP(WeatherData& out)
     uint16_t id = doc["weather"][0]["id"] | 666;
     const char* desc = doc["weather"][0]["description"] | "Unknown";
 
-    out.temperature = String(temp, 1) + "°C";
-    out.condition = desc;
+    out.temperatureC = temp;
+    strlcpy(out.condition, desc, sizeof(out.condition));
+    strlcpy(out.icon, doc["weather"][0]["icon"] | "", sizeof(out.icon));
     out.id = id;
 
     // OpenWeather returns unix dt, sunrise, sunset
     out.dt = doc["dt"] | (unsigned long)time(nullptr);
-    out.sunrise = strTime((time_t)(doc["sys"]["sunrise"] | 0));
-    out.sunset  = strTime((time_t)(doc["sys"]["sunset"]  | 0));
-    out.humidity = String((int)(doc["main"]["humidity"] | 0)) + "%";
-    out.wind_speed = String((float)(doc["wind"]["speed"] | 0.0f), 1) + " m/s";
+    out.sunrise = doc["sys"]["sunrise"] | 0u;
+    out.sunset  = doc["sys"]["sunset"]  | 0u;
+    out.humidity = doc["main"]["humidity"] | 0;
+    out.windSpeed = doc["wind"]["speed"] | 0.0f;
     Serial.println("[Weather] Fetched current weather via HTTP.");
     g_weatherUpdated = true;
 
@@ -9,23 +9,39 @@
 #include <stdbool.h>
 #include "tide.h"
 
+#define TIME_OFFSET 1UL * 3600UL // UTC + 0 hour
+
 
 
 // Declare WeatherData structure
+//
+// Plain old data: numbers as numbers, times as unix epochs, text in fixed
+// buffers. Copying or comparing it never touches the heap; text for labels
+// is formatted at the UI edge (weather_format_temp etc.).
+#define WEATHER_CONDITION_LEN 32   // "thunderstorm with heavy drizzle" fits
+#define WEATHER_ICON_CODE_LEN 4    // OpenWeather icon code, "04d"
+
 struct WeatherData {
-    String temperature;
-    String condition;
-    String icon;
-    String sunrise;
-    String sunset;
-    String wind_speed;
-    String humidity;
-    String moonphase;
-    unsigned long lastUpdate; 
-    uint16_t id;
+    float         temperatureC;   // NAN = no reading yet
+    float         windSpeed;      // m/s
+    float         moonphase;      // 0..1, 0 until the forecast API fills it
+    uint32_t      sunrise;        // unix epoch, 0 = unknown
+    uint32_t      sunset;
+    unsigned long lastUpdate;
     unsigned long dt;
+    uint16_t      id;
+    uint8_t       humidity;       // %
+    char          condition[WEATHER_CONDITION_LEN];
+    char          icon[WEATHER_ICON_CODE_LEN];
 };
 
+// UI-edge formatting into the caller's buffer; returns buf.
+// "12.5°C" (or "N/A"), "4.1 m/s", "71%", "07:12" local time.
+const char* weather_format_temp(const WeatherData& wd, char* buf, size_t len);
+const char* weather_format_wind(const WeatherData& wd, char* buf, size_t len);
+const char* weather_format_humidity(const WeatherData& wd, char* buf, size_t len);
+const char* weather_format_clock(uint32_t epoch, char* buf, size_t len);
+
 // Declare external variables
 extern String api_key;
 extern String latitude;
@@ -36,16 +52,25 @@ extern WeatherData currentWeatherData;
 
 // Declare functions
 void WeatherManagerBegin();
-bool WeatherUpdate();
 const WeatherData& WeatherGet();      // always returns latest (even if old)
 
+// Net worker jobs (NetWorker.h): blocking, WiFi must be up, no LVGL.
+// Results are staged until loop() commits them.
+bool WeatherSyncTime();               // NTP -> system clock, see WeatherConsumeNtpSync
+bool WeatherFetchTides();             // Stormglass (or tide.json inside the 3h cooldown)
+bool WeatherFetchCurrent();           // weather.json, OpenWeather if it's stale
+
+// From loop() under the LVGL lock, after the job's completion event.
+// Copy the staged result into WeatherGet() / TideGet(); false if nothing new.
+bool WeatherCommitCurrent();
+bool WeatherCommitTides();
+
 void WeatherInit();
 void printCurrentWeather();
-void updateWeatherData();
-const char* getMeteoconIcon(uint16_t id, bool today);
+bool updateWeatherData();
 bool loadWeatherDataFromFile(const char* filePath, WeatherData& weather);
 void saveWeatherDataToFile(const char* filePath, const WeatherData& weather);
-void initializeWeatherData();
+bool initializeWeatherData();
 bool WeatherConsumeNtpSync(time_t *outEpoch);
 
 static bool fetchCurrentWeatherHTTP(WeatherData& out);
@@ -23,11 +23,21 @@
 #include "SettingsManager.h"
 #include "Tide.h"
 #include "TideService.h"
+#include "FrameProfiler.h"
+#include "ImageCache.h"
+#include "AssetPack.h"
+#include "LvglHeap.h"
+#include "MemMonitor.h"
+#include "ScreenCache.h"
+#include "NetWorker.h"
+#include "SerialConsole.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 
 
 //////////////////// DEFINITIONS ///////////////////////////////
@@ -67,7 +77,14 @@
 
 #define LVGL_BUF_LEN (LCD_WIDTH * LCD_HEIGHT / 10)
 
-#define DIRECT_MODE // Uncomment to enable full frame buffer
+// Full 466x466 frame in PSRAM; LVGL redraws only invalidated areas in place
+// and we push just those rectangles. Comment out for double-buffered strips.
+#define DIRECT_MODE
+
+// Only send the part of each row that lies inside the round glass. The
+// corners of the 466x466 buffer (~21%) can never be seen.
+#define ROUND_MASK_FLUSH
+#define ROUND_MASK_BAND_LINES 8   // rows per CASET/RASET window (keep even)
 
 #define DRAW_BUF_SIZE (LCD_WIDTH * LCD_HEIGHT / 6 * (LV_COLOR_DEPTH / 8))
 #define FULL_BUF_SIZE (LCD_WIDTH * LCD_HEIGHT * (LV_COLOR_DEPTH / 8))
@@ -80,15 +97,18 @@ extern TideService g_tideService;
 
 //Adding a seperate task to stop it crashing out
 static TaskHandle_t lvglTaskHandle = nullptr;
-static SemaphoreHandle_t lvglMutex = nullptr;
 
+// LVGL runs on its FreeRTOS OS layer (lv_conf.h), so it has its own global
+// recursive lock that lv_timer_handler() and the draw threads use. Anything
+// touching LVGL from another task (loop, managers) must go through these.
+// Only valid after lv_init().
 static inline void lvgl_lock()
 {
-  if(lvglMutex) xSemaphoreTake(lvglMutex, portMAX_DELAY);
+  lv_lock();
 }
 static inline void lvgl_unlock()
 {
-  if(lvglMutex) xSemaphoreGive(lvglMutex);
+  lv_unlock();
 }
 
 
@@ -126,7 +146,7 @@ uint32_t bufSize;
 
 TouchDrvCSTXXX touch;
 int16_t x[5], y[5];
-bool isPressed = false;
+volatile bool isPressed = false;
 unsigned long lastInteractionTime = 0;
 
 
@@ -156,15 +176,67 @@ void setFlag(void) {
   pmu_flag = true;
 }
 
+// Longest the LVGL task sleeps when no timer is due (clock timer is 1 s anyway)
+#define LVGL_MAX_IDLE_MS 500
+
+// Wake the LVGL task early (new input, UI changed from another task, ...)
+static inline void lvgl_wake()
+{
+  if(lvglTaskHandle && xTaskGetCurrentTaskHandle() != lvglTaskHandle) {
+    xTaskNotifyGive(lvglTaskHandle);
+  }
+}
+
+static lv_indev_t *touchIndev = nullptr;
+static volatile bool touchIrq = false;
+
+static void IRAM_ATTR touch_isr()
+{
+  isPressed = true;
+  touchIrq = true;
+
+  BaseType_t woken = pdFALSE;
+  if(lvglTaskHandle) vTaskNotifyGiveFromISR(lvglTaskHandle, &woken);
+  if(woken) portYIELD_FROM_ISR();
+}
+
 static void lvgl_task(void* pv)
 {
   (void)pv;
   for(;;) {
+    const uint32_t lockStartUs = (uint32_t)esp_timer_get_time();
     lvgl_lock();
-    lv_timer_handler();           // all drawing + image decode happens here
+    FrameProfiler::instance().handlerStart((uint32_t)esp_timer_get_time() - lockStartUs);
+
+    // Touch read timer is paused while idle; the IRQ brings it back
+    if(touchIrq && touchIndev) {
+      touchIrq = false;
+      lv_timer_resume(lv_indev_get_read_timer(touchIndev));
+    }
+
+    uint32_t waitMs = lv_timer_handler();   // all drawing + image decode happens here
+    FrameProfiler::instance().handlerEnd();
+
+    // Sample once the new screen has been built and drawn
+    static lv_obj_t* lastScreen = nullptr;
+    lv_obj_t* screen = lv_screen_active();
+    const bool screenChanged = screen != lastScreen;
+    lastScreen = screen;
+
+    // Weather only changes on a net worker commit (applied in loop()); this
+    // catches it up when the screen comes back into view
+    if(screenChanged) ui_WeatherScreen_tick();
+
+    // Outside any event handler, so screens can be deleted here
+    screen_cache_tick();
     lvgl_unlock();
 
-    vTaskDelay(pdMS_TO_TICKS(5)); // ~200 Hz; LVGL will internally pace redraws
+    if(screenChanged) MemMonitor::instance().sample(MemPhase::ScreenChange);
+
+    // Sleep until the next LVGL timer is due, or until someone notifies us
+    if(waitMs == LV_NO_TIMER_READY || waitMs > LVGL_MAX_IDLE_MS) waitMs = LVGL_MAX_IDLE_MS;
+    if(waitMs == 0) waitMs = 1;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
   }
 }
 
@@ -176,6 +248,8 @@ void notifyUserInteraction()
         DisplayManager::instance().setBrightness(g_fullBrightness);
         isScreenDimmed = false;
     }
+
+    lvgl_wake();
 }
 
 /* // LVGL v9 flush callback
@@ -198,44 +272,484 @@ static void my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px
 //////////////////////////////////////////
 
 
-static void my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+//////////////////// FLUSH PIPELINE ///////////////////////////
+// LVGL renders into PSRAM. my_disp_flush() only hands the finished area(s)
+// to flush_task (core 0), which pushes them over QSPI and signals
+// lv_display_flush_ready() once the transfer has completed. In PARTIAL mode
+// LVGL is already rendering the next strip into the other buffer meanwhile.
+//
+// In DIRECT_MODE px_map is the whole persistent frame. Every invalidated area
+// of a refresh is rendered in place first; on the last one we merge the list
+// and push only those rectangles, so a 1 Hz tick costs a few small windows
+// instead of several full-width strips.
+//
+// Arduino_ESP32QSPI::writePixels bounces pixels through its own pair of
+// internal DMA buffers (swap chunk N+1 while chunk N is in flight), so we no
+// longer memcpy into a separate dma_buf first - that was a wasted copy.
+
+#define FLUSH_MAX_AREAS 32  // matches LV_INV_BUF_SIZE
+
+struct FlushJob {
+  lv_display_t   *disp;
+  const uint16_t *px;       // pixel at (originX, originY)
+  int32_t         originX;
+  int32_t         originY;
+  int32_t         stride;   // pixels per source row
+  bool            last;     // last flush of this refresh
+  uint32_t        profSeq;  // FrameProfiler frame this job belongs to
+  uint32_t        seq;      // flushSubmitted at queue time
+  uint8_t         count;
+  lv_area_t       areas[FLUSH_MAX_AREAS];
+};
+
+static TaskHandle_t      flushTaskHandle = nullptr;
+static QueueHandle_t     flushQueue      = nullptr;
+static SemaphoreHandle_t flushDoneSem    = nullptr;   // wakeup only; flushDone says which job
+static uint32_t          flushSubmitted  = 0;         // last job queued (under the LVGL lock)
+static volatile uint32_t flushDone       = 0;         // last job flush_ready was called for
+
+#ifdef DIRECT_MODE
+static lv_area_t dirtyAreas[FLUSH_MAX_AREAS];
+static uint8_t   dirtyCount    = 0;
+static bool      dirtyOverflow = false;
+#endif
+
+// Send one rectangle. Caller holds the bus and has called startWrite().
+static void panel_push_window(const lv_area_t *a, const uint16_t *src, int32_t stride)
 {
-  const int32_t w = lv_area_get_width(area);
-  const int32_t h = lv_area_get_height(area);
-
-  // Tune this. 16–32 lines is usually a sweet spot.
-  constexpr int32_t CHUNK_LINES = 20;
-
-  // Internal DMA bounce buffer (enough for full width × CHUNK_LINES)
-  static uint16_t *dma_buf = nullptr;
-  if(!dma_buf) {
-    dma_buf = (uint16_t*)heap_caps_malloc(466 * CHUNK_LINES * sizeof(uint16_t),
-                                         MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
-    if(!dma_buf) {
-      // If this fails, drop CHUNK_LINES or handle error.
-      Serial.println("[LVGL] dma_buf alloc failed");
-      lv_display_flush_ready(disp);
-      return;
+  const int32_t w = lv_area_get_width(a);
+  const int32_t h = lv_area_get_height(a);
+
+  static_cast<Arduino_CO5300*>(gfx)->writeAddrWindow(a->x1, a->y1, w, h);
+
+  if(stride == w) {
+    bus->writePixels((uint16_t*)src, (uint32_t)w * h);
+    return;
+  }
+
+  // Sub-rectangle of the full frame: one row at a time, RAMWR continues
+  for(int32_t y = 0; y < h; y++) {
+    bus->writePixels((uint16_t*)(src + y * stride), (uint32_t)w);
+  }
+}
+
+#ifdef ROUND_MASK_FLUSH
+// Visible chord per row, already aligned for the CO5300 (x1 even, x2 odd).
+// Rows with x1 > x2 are entirely outside the circle.
+static int16_t roundRowX1[LCD_HEIGHT];
+static int16_t roundRowX2[LCD_HEIGHT];
+
+static void round_mask_init()
+{
+  const float r  = LCD_WIDTH / 2.0f;
+  const float cy = LCD_HEIGHT / 2.0f;
+
+  for(int32_t y = 0; y < LCD_HEIGHT; y++) {
+    const float dy = (y + 0.5f) - cy;
+    if(fabsf(dy) >= r) {
+      roundRowX1[y] = 1;
+      roundRowX2[y] = 0;
+      continue;
     }
+    const float half = sqrtf(r * r - dy * dy);
+    int32_t x1 = (int32_t)floorf(r - half);
+    int32_t x2 = (int32_t)ceilf(r + half) - 1;
+    if(x1 < 0) x1 = 0;
+    if(x2 > LCD_WIDTH - 1) x2 = LCD_WIDTH - 1;
+    roundRowX1[y] = (int16_t)(x1 & ~1);
+    roundRowX2[y] = (int16_t)(x2 | 1);
   }
+}
+#endif
 
-  const uint16_t *src = (const uint16_t*)px_map;
+// Bytes that went out / were skipped by the round mask, per refresh
+static uint32_t flushBytesSent       = 0;
+static uint32_t flushBytesSaved      = 0;
+static volatile uint32_t lastFrameBytesSent  = 0;
+static volatile uint32_t lastFrameBytesSaved = 0;
 
-  gfx->startWrite();
+// Send one invalidated rectangle, trimmed to the visible circle if enabled.
+static void panel_push_rect(const lv_area_t *a, const uint16_t *src, int32_t stride)
+{
+#ifdef ROUND_MASK_FLUSH
+  // Bands start on even rows (rounder_event_cb keeps y1 even) and the chord
+  // of a band is the widest row in it, i.e. the one closest to the centre.
+  for(int32_t by = a->y1; by <= a->y2; by += ROUND_MASK_BAND_LINES) {
+    const int32_t ey = LV_MIN(by + ROUND_MASK_BAND_LINES - 1, a->y2);
+    const int32_t mid = LV_CLAMP(by, LCD_HEIGHT / 2, ey);
+
+    lv_area_t band;
+    band.y1 = by;
+    band.y2 = ey;
+    band.x1 = LV_MAX(a->x1, (int32_t)roundRowX1[mid]);
+    band.x2 = LV_MIN(a->x2, (int32_t)roundRowX2[mid]);
+
+    const uint32_t full = (uint32_t)lv_area_get_width(a) * (ey - by + 1);
+    if(band.x1 > band.x2) {
+      flushBytesSaved += full * 2;
+      continue;
+    }
+
+    const uint32_t sent = (uint32_t)lv_area_get_width(&band) * (ey - by + 1);
+    flushBytesSent  += sent * 2;
+    flushBytesSaved += (full - sent) * 2;
 
-  for(int32_t y = 0; y < h; y += CHUNK_LINES) {
-    const int32_t lines = (y + CHUNK_LINES <= h) ? CHUNK_LINES : (h - y);
-    const int32_t count = w * lines;
+    panel_push_window(&band, src + (by - a->y1) * stride + (band.x1 - a->x1), stride);
+  }
+#else
+  flushBytesSent += (uint32_t)lv_area_get_width(a) * lv_area_get_height(a) * 2;
+  panel_push_window(a, src, stride);
+#endif
+}
 
-    // Copy into DMA-capable memory
-    memcpy(dma_buf, src + (y * w), count * sizeof(uint16_t));
+static void flush_task(void* pv)
+{
+  (void)pv;
+  static FlushJob job;   // ~550 bytes, keep it off the task stack
 
+  for(;;) {
+    if(xQueueReceive(flushQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+
+    // Brightness/on-off writes go over the same bus
+    DisplayManager::instance().lockBus();
+    const uint32_t startUs = (uint32_t)esp_timer_get_time();
+    const uint32_t sentBefore = flushBytesSent;
+    gfx->startWrite();
+    for(uint8_t i = 0; i < job.count; i++) {
+      const lv_area_t *a = &job.areas[i];
+      const uint16_t *src = job.px + (a->y1 - job.originY) * job.stride + (a->x1 - job.originX);
+      panel_push_rect(a, src, job.stride);
+    }
+    gfx->endWrite();
+    FrameProfiler::instance().flushDone(job.profSeq,
+                                        (uint32_t)esp_timer_get_time() - startUs,
+                                        (flushBytesSent - sentBefore) / 2);
+    DisplayManager::instance().unlockBus();
+
+    if(job.last) {
+      lastFrameBytesSent  = flushBytesSent;
+      lastFrameBytesSaved = flushBytesSaved;
+      flushBytesSent  = 0;
+      flushBytesSaved = 0;
+
+#ifdef ROUND_MASK_FLUSH
+      static uint32_t lastLogMs = 0;
+      if(millis() - lastLogMs >= 10000) {
+        lastLogMs = millis();
+        Serial.printf("[LVGL] last frame: sent %u B, round mask saved %u B\n",
+                      (unsigned)lastFrameBytesSent, (unsigned)lastFrameBytesSaved);
+      }
+#endif
+    }
 
-    gfx->draw16bitRGBBitmap(area->x1, area->y1 + y, dma_buf, w, lines);
+    // flush_ready first: once the LVGL task is released it may start the next
+    // flush, and a late flush_ready would mark that one done too early
+    lv_display_flush_ready(job.disp);
+    flushDone = job.seq;
+    xSemaphoreGive(flushDoneSem);
   }
+}
 
-  gfx->endWrite();
-  lv_display_flush_ready(disp);
+#ifdef DIRECT_MODE
+static inline int32_t area_px(const lv_area_t *a)
+{
+  return lv_area_get_width(a) * lv_area_get_height(a);
+}
+
+// Same rule LVGL uses when joining invalidated areas: merge two rectangles
+// if they overlap/touch and their bounding box isn't bigger than both apart.
+// LVGL has already joined most of them, but the even/odd rounding done in
+// rounder_event_cb can make neighbours overlap again.
+static uint8_t merge_dirty_areas(lv_area_t *areas, uint8_t count)
+{
+  bool merged = true;
+  while(merged) {
+    merged = false;
+    for(uint8_t i = 0; i < count && !merged; i++) {
+      for(uint8_t j = i + 1; j < count; j++) {
+        const lv_area_t &a = areas[i];
+        const lv_area_t &b = areas[j];
+        if(a.x1 > b.x2 + 1 || b.x1 > a.x2 + 1 || a.y1 > b.y2 + 1 || b.y1 > a.y2 + 1) continue;
+
+        lv_area_t u;
+        lv_area_set(&u, LV_MIN(a.x1, b.x1), LV_MIN(a.y1, b.y1),
+                        LV_MAX(a.x2, b.x2), LV_MAX(a.y2, b.y2));
+        if(area_px(&u) > area_px(&a) + area_px(&b)) continue;
+
+        areas[i] = u;
+        areas[j] = areas[--count];
+        merged = true;
+        break;
+      }
+    }
+  }
+  return count;
+}
+#endif
+
+static void my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+  static FlushJob job;
+  job.disp = disp;
+
+#ifdef DIRECT_MODE
+  if(dirtyCount < FLUSH_MAX_AREAS) dirtyAreas[dirtyCount++] = *area;
+  else dirtyOverflow = true;
+
+  // Already rendered into the frame; nothing to send until the last area
+  if(!lv_display_flush_is_last(disp)) {
+    lv_display_flush_ready(disp);
+    return;
+  }
+
+  job.px      = (const uint16_t*)px_map;
+  job.originX = 0;
+  job.originY = 0;
+  job.stride  = (int32_t)screenWidth;
+
+  if(dirtyOverflow) {
+    lv_area_set(&job.areas[0], 0, 0, (int32_t)screenWidth - 1, (int32_t)screenHeight - 1);
+    job.count = 1;
+  } else {
+    memcpy(job.areas, dirtyAreas, dirtyCount * sizeof(lv_area_t));
+    job.count = merge_dirty_areas(job.areas, dirtyCount);
+  }
+  dirtyCount = 0;
+  dirtyOverflow = false;
+  job.last = true;
+#else
+  job.px       = (const uint16_t*)px_map;
+  job.originX  = area->x1;
+  job.originY  = area->y1;
+  job.stride   = lv_area_get_width(area);
+  job.count    = 1;
+  job.areas[0] = *area;
+  job.last     = lv_display_flush_is_last(disp);
+#endif
+
+  job.profSeq = FrameProfiler::instance().flushQueued(job.count);
+
+  // Drop a wakeup left by a job LVGL never had to wait for
+  xSemaphoreTake(flushDoneSem, 0);
+  job.seq = flushSubmitted + 1;
+  if(flushQueue && xQueueSend(flushQueue, &job, portMAX_DELAY) == pdTRUE) {
+    flushSubmitted = job.seq;
+  } else {
+    lv_display_flush_ready(disp);
+  }
+}
+
+// LVGL calls this when it needs a draw buffer back. Block on the flush task
+// instead of letting LVGL spin on the flushing flag (it would starve loopTask).
+static void my_flush_wait(lv_display_t *disp)
+{
+  (void)disp;
+  const uint32_t startUs = (uint32_t)esp_timer_get_time();
+  // LVGL skips this when the job finished before it looked, so gives can go
+  // unconsumed: wait on the job number, the semaphore is only the wakeup
+  while(flushDone != flushSubmitted) {
+    xSemaphoreTake(flushDoneSem, pdMS_TO_TICKS(20));
+  }
+  FrameProfiler::instance().flushWaited((uint32_t)esp_timer_get_time() - startUs);
+}
+
+static void flush_pipeline_init()
+{
+#ifdef ROUND_MASK_FLUSH
+  round_mask_init();
+#endif
+
+  flushQueue   = xQueueCreate(1, sizeof(FlushJob));
+  flushDoneSem = xSemaphoreCreateBinary();
+  if(!flushQueue || !flushDoneSem) {
+    Serial.println("[LVGL] Failed to create flush queue");
+    while(true) delay(100);
+  }
+
+  // Core 0: the transfer runs next to WiFi while core 1 keeps rendering
+  BaseType_t ok = xTaskCreatePinnedToCore(
+      flush_task,
+      "lv_flush",
+      4096,
+      nullptr,
+      3,
+      &flushTaskHandle,
+      0);
+
+  if(ok != pdPASS) {
+    Serial.println("[LVGL] Failed to create flush task");
+    while(true) delay(100);
+  }
+}
+
+
+// "prof" dumps frame timing percentiles per screen, "prof reset" clears them
+static void cmd_prof(const char* args)
+{
+  lvgl_lock();
+  if(strcmp(args, "reset") == 0) {
+    FrameProfiler::instance().reset();
+    Serial.println("[Prof] cleared");
+  } else {
+    FrameProfiler::instance().dump();
+  }
+  lvgl_unlock();
+}
+
+
+// "bench [main|clock|weather] [n]" - forces n full redraws of a screen and
+// reports the refresh time. Compare builds with LV_DRAW_SW_DRAW_UNIT_CNT 1 vs 2;
+// "prof" afterwards has the render/flush split for the same frames.
+static void cmd_bench(const char* args)
+{
+  lv_obj_t *scr = ui_MainScreen;
+  const char *name = "Main";
+  lvgl_lock();
+  if(strncmp(args, "weather", 7) == 0) {
+    screen_cache_ensure(&ui_WeatherScreen, ui_WeatherScreen_screen_init);
+    scr = ui_WeatherScreen; name = "Weather";
+  }
+  else if(strncmp(args, "clock", 5) == 0) { scr = ui_ClockScreen;   name = "Clock"; }
+  lvgl_unlock();
+
+  int n = 20;
+  const char *num = strchr(args, ' ');
+  if(num && atoi(num + 1) > 0) n = atoi(num + 1);
+
+  if(!scr) {
+    Serial.println("[Bench] screen not created");
+    return;
+  }
+
+  lvgl_lock();
+  lv_obj_t *prev = lv_screen_active();
+  lv_screen_load(scr);
+  lv_refr_now(disp);          // warm-up: first draw decodes images etc.
+  my_flush_wait(disp);
+
+  uint32_t total = 0, minUs = UINT32_MAX, maxUs = 0;
+  for(int i = 0; i < n; i++) {
+    lv_obj_invalidate(scr);
+    FrameProfiler::instance().handlerStart(0);
+    const uint32_t t0 = (uint32_t)esp_timer_get_time();
+    lv_refr_now(disp);
+    const uint32_t dt = (uint32_t)esp_timer_get_time() - t0;
+    FrameProfiler::instance().handlerEnd();
+    my_flush_wait(disp);
+
+    total += dt;
+    if(dt < minUs) minUs = dt;
+    if(dt > maxUs) maxUs = dt;
+  }
+
+  lv_screen_load(prev);
+  lvgl_unlock();
+
+  Serial.printf("[Bench] %s: %d full redraws, avg %.2f ms (min %.2f, max %.2f), %d draw unit(s)\n",
+                name, n, total / 1000.0f / n, minUs / 1000.0f, maxUs / 1000.0f,
+                (int)LV_DRAW_SW_DRAW_UNIT_CNT);
+}
+
+
+// "sweep [on|off]" - toggles the gliding second hand on the Clock screen
+static void cmd_sweep(const char* args)
+{
+  lvgl_lock();
+  if(strcmp(args, "on") == 0) {
+    clock_screen_set_sweep(true);
+  } else if(strcmp(args, "off") == 0) {
+    clock_screen_set_sweep(false);
+  } else {
+    Serial.printf("[Clock] sweep is %s\n", clock_screen_sweep_enabled() ? "on" : "off");
+  }
+  lvgl_unlock();
+}
+
+
+// "lvmem [reset]" - LVGL's internal-RAM / PSRAM split against the system heaps
+static void cmd_lvmem(const char* args)
+{
+  if(strcmp(args, "reset") == 0) {
+    lvgl_heap_reset_peaks();
+    Serial.println("[LvHeap] peaks cleared");
+    return;
+  }
+  lvgl_heap_dump("now");
+}
+
+
+// "mem [reset]" - heap free/largest and task stack watermarks per phase
+static void cmd_mem(const char* args)
+{
+  if(strcmp(args, "reset") == 0) {
+    MemMonitor::instance().reset();
+    Serial.println("[Mem] history cleared");
+    return;
+  }
+  MemMonitor::instance().dump();
+}
+
+
+// "net" - net worker jobs: runs, failures and how long they take
+static void cmd_net(const char* args)
+{
+  (void)args;
+  net_worker_dump();
+}
+
+
+// "screens [warm <n>]" - which screens are built, what they cost, and how
+// many evictable ones stay warm
+static void cmd_screens(const char* args)
+{
+  lvgl_lock();
+  if(strncmp(args, "warm ", 5) == 0) screen_cache_set_warm((uint8_t)atoi(args + 5));
+  screen_cache_dump();
+  lvgl_unlock();
+}
+
+
+// "imgcache [reset|<KB>]" - PSRAM image cache occupancy and hit rate;
+// a number sets a new budget in KB
+static void cmd_imgcache(const char* args)
+{
+  lvgl_lock();
+  if(strcmp(args, "reset") == 0) {
+    ImageCache::instance().resetStats();
+    Serial.println("[ImgCache] counters cleared");
+  } else {
+    if(atoi(args) > 0) ImageCache::instance().setBudget((uint32_t)atoi(args) * 1024u);
+    ImageCache::instance().dump();
+  }
+  lvgl_unlock();
+}
+
+
+// Warm the image cache with the background the Weather screen will want, so the
+// first visit after a condition change is a plain blit instead of a 245 KB
+// LittleFS read. Runs as a net worker job (NET_JOB_WEATHER_BG) and only holds
+// the LVGL lock for the cache lookups, not the file read.
+static bool prefetch_weather_bg(void)
+{
+  lvgl_lock();
+  const WeatherData& wd = WeatherGet();
+  const char* path = ui_WeatherScreen_bg_path(wd.id, wd.icon);
+  const bool cached = ImageCache::instance().contains(path);
+  lvgl_unlock();
+  if(cached) return true;
+
+  ImageCache::Blob blob;
+  const uint32_t t0 = millis();
+  if(!ImageCache::readFile(path, blob)) {
+    Serial.printf("[Weather] bg prefetch failed: %s\n", path);
+    return false;
+  }
+
+  lvgl_lock();
+  ImageCache::instance().insert(path, blob);
+  lvgl_unlock();
+  Serial.printf("[Weather] prefetched %s in %lu ms\n", path, (unsigned long)(millis() - t0));
+  return true;
 }
 
 
@@ -256,6 +770,10 @@ static void rounder_event_cb(lv_event_t *e)
             area->y1 = (area->y1) & ~1; // Round down to even  
             area->y2 = (area->y2) | 1;  // Round up to odd
         }
+
+        // Something outside the LVGL task changed the UI (under lvgl_lock):
+        // don't leave it waiting for the next timer deadline.
+        lvgl_wake();
     }
 }
 
@@ -269,30 +787,57 @@ void lvgl_init_display()
   screenWidth  = gfx->width();
   screenHeight = gfx->height();
 
-// ---- LVGL draw buffer: SINGLE buffer, PARTIAL mode ----
+#ifdef DIRECT_MODE
+// ---- LVGL draw buffer: ONE persistent full frame, DIRECT mode ----
+// LVGL keeps the previous frame and only re-renders invalidated areas in it.
+const uint32_t buf_bytes = FULL_BUF_SIZE;
+
+disp_draw_buf  = (lv_color_t*)heap_caps_malloc(buf_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+disp_draw_buf2 = NULL;
+
+if(!disp_draw_buf) {
+  Serial.println("[LVGL] full frame alloc failed!");
+  while(true) delay(100);
+}
+memset(disp_draw_buf, 0, buf_bytes);
+#else
+// ---- LVGL draw buffers: TWO buffers, PARTIAL mode ----
+// One is rendered while the other is being flushed by flush_task.
 // Start with 80 lines. If WiFi ever fails to init, drop to 60.
 const uint32_t buf_lines = 160;  // try 160, then 200/240
 const uint32_t buf_bytes = (uint32_t)screenWidth * buf_lines * sizeof(lv_color_t);
 
 disp_draw_buf  = (lv_color_t*)heap_caps_malloc(buf_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-disp_draw_buf2 = NULL;
+disp_draw_buf2 = (lv_color_t*)heap_caps_malloc(buf_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
 
-if(!disp_draw_buf) {
+if(!disp_draw_buf || !disp_draw_buf2) {
   Serial.println("[LVGL] disp_draw_buf alloc failed!");
   while(true) delay(100);
 }
+#endif
 
 Serial.printf("[LVGL] internal DMA free after buffers: %u bytes\n",
               (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA));
 
+flush_pipeline_init();
+
 disp = lv_display_create(screenWidth, screenHeight);
 lv_display_set_flush_cb(disp, my_disp_flush);
+lv_display_set_flush_wait_cb(disp, my_flush_wait);
 
+#ifdef DIRECT_MODE
 lv_display_set_buffers(disp,
                        disp_draw_buf,
                        NULL,
                        buf_bytes,
+                       LV_DISPLAY_RENDER_MODE_DIRECT);
+#else
+lv_display_set_buffers(disp,
+                       disp_draw_buf,
+                       disp_draw_buf2,
+                       buf_bytes,
                        LV_DISPLAY_RENDER_MODE_PARTIAL);
+#endif
 
 Serial.println("[LVGL] display init done");
 }
@@ -317,25 +862,36 @@ void init_touch()
   touch.setMirrorXY(true, true);
   Serial.println("Touch coords set");
   pinMode(TOUCH_PIN, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(TOUCH_PIN),
-                  [](){ isPressed = true; },
-                  FALLING);
+  attachInterrupt(digitalPinToInterrupt(TOUCH_PIN), touch_isr, FALLING);
   Serial.println("Touch interrupt attached");
 }
 
+// Released reads before the read timer is paused again (~1 s at 33 ms).
+// Scroll throw runs on released reads, so don't stop straight away.
+#define TOUCH_IDLE_READS 30
+
 /*Read the touchpad*/
 void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
+  static uint16_t releasedReads = 0;
   uint8_t touched = touch.getPoint(x, y, touch.getSupportTouchPoint());
 
   if (touched > 0) {
     data->state = LV_INDEV_STATE_PR;  
     data->point.x = x[0];             
     data->point.y = y[0];
+    releasedReads = 0;
 
     notifyUserInteraction();
 
   } else {
     data->state = LV_INDEV_STATE_REL;  
+    isPressed = false;
+
+    // Nothing to poll for: stop the 33 ms read timer until the next touch IRQ
+    if (++releasedReads >= TOUCH_IDLE_READS) {
+      releasedReads = 0;
+      lv_timer_pause(lv_indev_get_read_timer(indev));
+    }
   }
 }
 
@@ -464,6 +1020,10 @@ void setup() {
  
     Serial.println("Arduino_GFX SmartWatch V5 Starting...");
 
+  // setup() runs on loopTask, so its stack gets watched from here
+  MemMonitor::instance().begin();
+  MemMonitor::instance().watchTask(xTaskGetCurrentTaskHandle(), getArduinoLoopTaskStackSize());
+
 
   String LVGL_Arduino = "Hello Arduino! ";
   //LVGL_Arduino += String('V') + lv_version_major() + "." + lv_version_minor() + "." + lv_version_patch();
@@ -515,6 +1075,16 @@ void setup() {
   DisplayManager::instance().setBrightness(255);
 
 
+  FrameProfiler::instance().begin();
+  serial_console_register("prof", "frame timing per screen ('prof reset' clears)", cmd_prof);
+  serial_console_register("bench", "full redraw timing: bench [main|clock|weather] [n]", cmd_bench);
+  serial_console_register("sweep", "gliding clock second hand: sweep [on|off]", cmd_sweep);
+  serial_console_register("imgcache", "image cache stats: imgcache [reset|<budget KB>]", cmd_imgcache);
+  serial_console_register("lvmem", "LVGL heap per tier: lvmem [reset]", cmd_lvmem);
+  serial_console_register("mem", "heap and stack watermarks per phase: mem [reset]", cmd_mem);
+  serial_console_register("screens", "screen cache: screens [warm <n>]", cmd_screens);
+  serial_console_register("net", "net worker job timings", cmd_net);
+
   lvgl_init_display();
     Serial.println("LVGL_init_display ran");
 
@@ -527,6 +1097,7 @@ void setup() {
     lv_indev_t * indev = lv_indev_create();
     lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER); /*Touchpad should have POINTER type*/
     lv_indev_set_read_cb(indev, my_touchpad_read);
+    touchIndev = indev;
 
     Serial.println("Input Driver set up");
 
@@ -555,6 +1126,7 @@ void setup() {
 PowerManager::instance().setIrqReadFn(readPmuIrqFromExpander, /*activeLow=*/true);
     clock_init();
     Serial.println("clock_init success");
+    asset_pack_init();   // before ui_init so the first images come from flash
     ui_init();
     Serial.println("ui_init success");
 
@@ -563,14 +1135,8 @@ time_manager_begin();
 time_manager_bootstrap_system_time_from_rtc();
  checkWeatherFlag = true;
 
-   lvglMutex = xSemaphoreCreateMutex();
-  if(!lvglMutex) {
-    Serial.println("[LVGL] Failed to create mutex");
-    while(true) delay(100);
-  }
-
   // Big stack is the key: TJPGD decode + draw can be stack-hungry.
-  // 16384 is usually enough; if you still see canary trips, go 20480.
+  // 16384 is a guess; "mem" shows its real peak, tune from that.
   BaseType_t ok = xTaskCreatePinnedToCore(
       lvgl_task,
       "lvgl",
@@ -578,7 +1144,7 @@ time_manager_bootstrap_system_time_from_rtc();
       nullptr,
       2,              // priority
       &lvglTaskHandle,
-      1               // core 1 (Arduino loopTask often runs core 1 too; either is fine)
+      1               // core 1; the LVGL draw threads float across both cores
   );
 
   if(ok != pdPASS) {
@@ -587,8 +1153,14 @@ time_manager_bootstrap_system_time_from_rtc();
   }
 
 Serial.println("[LVGL] LVGL task started");
+  MemMonitor::instance().watchTask(lvglTaskHandle, 16384);
+  MemMonitor::instance().watchTask(flushTaskHandle, 4096);
+
+  net_worker_begin();
+  MemMonitor::instance().watchTask(net_worker_task(), NET_WORKER_STACK);
     
 Serial.println("Setup finished");
+  MemMonitor::instance().setPhase(MemPhase::Idle);
 
 
   
@@ -598,8 +1170,13 @@ void loop() {
   static bool weather_job_active = false;
   static uint32_t weather_job_started_ms = 0;
   static bool weather_ran_once = false;
+  static uint8_t weather_jobs_pending = 0;     // posted to the net worker, not finished yet
+  static uint32_t weather_loop_worst_ms = 0;   // slowest loop() pass during the refresh
+
+  const uint32_t loopStartMs = millis();
 
   wifi_manager_tick();
+  serial_console_tick();
 
   unsigned long currentTime = millis();
 
@@ -609,10 +1186,8 @@ void loop() {
     isScreenDimmed = true;
   }
 
-  // If DisplayManager touches LVGL internally, keep it locked
-  lvgl_lock();
+  // DisplayManager only talks to the panel (it has its own bus lock), no LVGL
   DisplayManager::instance().tick();
-  lvgl_unlock();
 
 PowerManager::instance().tick();
 
@@ -636,7 +1211,8 @@ if (PowerManager::instance().consumePkeyLongPressed()) {
     lvgl_unlock();
 }
 
-if (millis() - lastInteractionTime > SLEEP_AFTER_MS) {
+// Not while the net worker is mid-request; the refresh finishes first
+if (millis() - lastInteractionTime > SLEEP_AFTER_MS && weather_jobs_pending == 0) {
     // Inactivity-based sleep
     PowerManager::instance().enterLightSleep();
 
@@ -670,61 +1246,114 @@ if (millis() - lastInteractionTime > SLEEP_AFTER_MS) {
 
 
   // ---- WIFI LABEL UI (LVGL!) ----
-  lvgl_lock();
+  // Only touch the label when the colour actually changes: every style set
+  // invalidates it and wakes the LVGL task.
+  static uint32_t wifiLabelColor = 0xFFFFFFFF;
+  uint32_t wantColor;
   switch (wifi_manager_state()) {
     case WIFI_MGR_CONNECTING: {
       const bool on = ((millis() / 400) % 2) == 0;
-      lv_obj_set_style_text_color(ui_WiFiLabel,
-          lv_color_hex(on ? 0x41C7FF : 0x005578),
-          LV_PART_MAIN | LV_STATE_DEFAULT);
+      wantColor = on ? 0x41C7FF : 0x005578;
       break;
     }
     case WIFI_MGR_CONNECTED:
-      lv_obj_set_style_text_color(ui_WiFiLabel, lv_color_hex(0x41C7FF), LV_PART_MAIN | LV_STATE_DEFAULT);
+      wantColor = 0x41C7FF;
       break;
     default:
-      lv_obj_set_style_text_color(ui_WiFiLabel, lv_color_hex(0x005578), LV_PART_MAIN | LV_STATE_DEFAULT);
+      wantColor = 0x005578;
       break;
   }
-  lvgl_unlock();
+  if (wantColor != wifiLabelColor) {
+    wifiLabelColor = wantColor;
+    lvgl_lock();
+    lv_obj_set_style_text_color(ui_WiFiLabel, lv_color_hex(wantColor), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lvgl_unlock();
+  }
 
   // ---- WEATHER JOB ----
+  // NTP, tides and OpenWeather block for seconds, so they run on the net
+  // worker. This only posts them and applies the results as they come back.
   if (weather_job_active && wifi_manager_is_connected() && !weather_ran_once) {
     weather_ran_once = true;
+    weather_jobs_pending = 0;
+    weather_loop_worst_ms = 0;
+    if (net_worker_post(NET_JOB_NTP, WeatherSyncTime)) weather_jobs_pending++;
+    if (net_worker_post(NET_JOB_TIDE, WeatherFetchTides)) weather_jobs_pending++;
+    if (net_worker_post(NET_JOB_WEATHER, WeatherFetchCurrent)) weather_jobs_pending++;
+  }
 
-    if (WeatherUpdate()) {
-      const WeatherData& wd = WeatherGet();
-      Serial.println("[Main] Applying weather to UI...");
+  NetJobEvent ev;
+  while (net_worker_poll(&ev)) {
+    switch (ev.kind) {
+      case NET_JOB_NTP: {
+        if (weather_jobs_pending) weather_jobs_pending--;
+        // RTC is on the I2C bus with the PMU and touch, so it's written from here
+        time_t ntpEpoch;
+        if (WeatherConsumeNtpSync(&ntpEpoch)) {
+          time_t rtcEpoch;
+          const bool rtcOk = time_manager_read_rtc_epoch(&rtcEpoch);
+          const long tol = 5;
+          if (!rtcOk || labs((long)(ntpEpoch - rtcEpoch)) > tol) {
+            time_manager_write_rtc_from_system_time();
+          }
+        }
+        break;
+      }
 
-      lvgl_lock();
-      ui_mainscreen_apply_weather(wd.id, wd.temperature.c_str());
-      lvgl_unlock();
-    }
+      case NET_JOB_TIDE:
+        if (weather_jobs_pending) weather_jobs_pending--;
+        lvgl_lock();
+        WeatherCommitTides();
+        lvgl_unlock();
+        break;
+
+      case NET_JOB_WEATHER:
+        if (weather_jobs_pending) weather_jobs_pending--;
+        if (ev.ok) {
+          lvgl_lock();
+          if (WeatherCommitCurrent()) {
+            const WeatherData& wd = WeatherGet();
+            Serial.println("[Main] Applying weather to UI...");
+
+            char tempText[16];
+            weather_format_temp(wd, tempText, sizeof(tempText));
+            ui_mainscreen_apply_weather(wd.id, tempText);
+            ui_WeatherScreen_tick();   // no-op unless it's the screen showing
+          }
+          lvgl_unlock();
+
+          // Flash only, so it doesn't hold up the WiFi power-down below
+          net_worker_post(NET_JOB_WEATHER_BG, prefetch_weather_bg);
+        }
+        break;
 
-    time_t ntpEpoch;
-    if (WeatherConsumeNtpSync(&ntpEpoch)) {
-      time_t rtcEpoch;
-      const bool rtcOk = time_manager_read_rtc_epoch(&rtcEpoch);
-      const long tol = 5;
-      if (!rtcOk || labs((long)(ntpEpoch - rtcEpoch)) > tol) {
-        time_manager_write_rtc_from_system_time();
-      }
+      default:
+        break;
     }
+  }
 
+  if (weather_job_active && weather_ran_once && weather_jobs_pending == 0) {
     wifi_manager_disconnect(true);
     last_weather_update = currentTime;
     weather_job_active = false;
+    Serial.printf("[Main] Weather refresh took %lu ms, slowest loop pass %lu ms\n",
+                  (unsigned long)(millis() - weather_job_started_ms),
+                  (unsigned long)weather_loop_worst_ms);
   }
 
-  if (weather_job_active && wifi_manager_state() == WIFI_MGR_FAILED) {
+  // Only while still connecting: once jobs are posted the worker owns the link
+  if (weather_job_active && !weather_ran_once && wifi_manager_state() == WIFI_MGR_FAILED) {
     weather_job_active = false;
     wifi_manager_disconnect(true);
   }
 
-  // Weather screen tick touches LVGL (image + labels)
-  lvgl_lock();
-  ui_WeatherScreen_tick();
-  lvgl_unlock();
+  if (weather_job_active) {
+    const uint32_t took = millis() - loopStartMs;
+    if (took > weather_loop_worst_ms) weather_loop_worst_ms = took;
+  }
+
+  // Nothing in here needs sub-10 ms service; don't spin loopTask on core 1
+  vTaskDelay(pdMS_TO_TICKS(10));
 }
 
 
@@ -10,6 +10,8 @@
 #include "ui_Power.h"
 #include "WeatherManager.h"
 #include "uiWeatherScreen.h"
+#include "ui_Settings.h"
+#include "ScreenCache.h"
 
 ///////////////////// DEFINITIONS //////////////////
 
@@ -211,12 +213,15 @@ void ui_init(void)
     lv_theme_t * theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
                                                false, LV_FONT_DEFAULT);
     lv_disp_set_theme(dispp, theme);
-    ui_MainScreen_screen_init();
-    ui_ClockScreen_screen_init();
-    ui_MusicControls_screen_init();
-    ui_Settings_screen_init();
-    ui_Power_screen_init();
-    ui_WeatherScreen_screen_init();
+
+    // Main, Clock and Power are pinned and built now. The others are built on
+    // first visit and may be evicted again (see ScreenCache.h).
+    screen_cache_register(&ui_MainScreen,    "Main",     ui_MainScreen_screen_init,    NULL, true);
+    screen_cache_register(&ui_ClockScreen,   "Clock",    ui_ClockScreen_screen_init,   NULL, true);
+    screen_cache_register(&ui_Power,         "Power",    ui_Power_screen_init,         NULL, true);
+    screen_cache_register(&ui_MusicControls, "Music",    ui_MusicControls_screen_init, ui_MusicControls_screen_destroy, false);
+    screen_cache_register(&ui_Settings,      "Settings", ui_Settings_screen_init,      ui_Settings_screen_destroy, false);
+    screen_cache_register(&ui_WeatherScreen, "Weather",  ui_WeatherScreen_screen_init, ui_WeatherScreen_screen_destroy, false);
     ui____initial_actions0 = lv_obj_create(NULL);
     lv_disp_load_scr(ui_MainScreen);
 
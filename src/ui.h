@@ -43,6 +43,7 @@ extern lv_obj_t *second_hand_img;
 
 // SCREEN: ui_MusicControls
 void ui_MusicControls_screen_init(void);
+void ui_MusicControls_screen_destroy(void);
 extern lv_obj_t * ui_MusicControls;
 void ui_event_MainArcMenuMusic(lv_event_t * e);
 extern lv_obj_t * ui_MainArcMenuMusic;
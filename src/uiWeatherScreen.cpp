@@ -6,6 +6,8 @@
 #include "ui_Settings.h"
 
 #include "WeatherManager.h"
+#include "ImageCache.h"
+#include "AssetManifest.h"
 
 #include <Arduino.h>
 #include <lvgl.h>
@@ -49,15 +51,11 @@ static lv_obj_t* s_condShadow = nullptr;
 static lv_obj_t* s_minmaxMain = nullptr;
 static lv_obj_t* s_minmaxShadow = nullptr;
 
-// Change detection (so we don’t spam setters)
-static uint16_t s_lastId = 0xFFFF;
-static unsigned long s_lastDt = 0;
-static String s_lastIcon;
-static String s_lastTemp;
-static String s_lastCond;
+// Change detection (so we don’t spam setters); a plain copy, no heap
+static WeatherData s_last = { NAN, 0, 0, 0, 0, 0, 0, 0xFFFF };
 
 // ---------- Helpers ----------
-static const char* pick_bg(uint16_t id, const String& icon);
+static AssetId pick_bg(uint16_t id, const char* icon);
 static const char* pick_label_for_arc_value(int v);
 static void set_shadow_label_text(lv_obj_t* shadow, lv_obj_t* main_lbl);
 
@@ -84,7 +82,7 @@ void ui_WeatherScreen_screen_init(void)
     lv_obj_center(s_bg);
 
     // A default so the screen isn’t blank at boot
-    lv_image_set_src(s_bg, "A:/lvgl/weather/cloudy-bg.jpg");
+    ImageCache::instance().setSrc(s_bg, asset_path(ASSET_WEATHER_CLOUDY_BG));
 
     // --- Outer ring arc menu ---
     s_arc = lv_arc_create(ui_WeatherScreen);
@@ -190,6 +188,18 @@ lv_obj_set_style_pad_all(s_arc, 0, 0);
     lv_obj_send_event(s_arc, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+// ScreenCache has deleted the screen; forget the widgets and the last values
+// shown so the next build repaints everything from WeatherGet()
+void ui_WeatherScreen_screen_destroy(void)
+{
+    ui_WeatherScreen = nullptr;
+    s_bg = s_arc = s_selLabel = nullptr;
+    s_tempMain = s_tempShadow = nullptr;
+    s_condMain = s_condShadow = nullptr;
+    s_minmaxMain = s_minmaxShadow = nullptr;
+    s_last = { NAN, 0, 0, 0, 0, 0, 0, 0xFFFF };
+}
+
 void ui_WeatherScreen_tick(void)
 {
     if(!ui_WeatherScreen) return;
@@ -197,30 +207,27 @@ void ui_WeatherScreen_tick(void)
 
     const WeatherData& wd = WeatherGet();
 
+    const bool sameTemp = (wd.temperatureC == s_last.temperatureC) ||
+                          (isnan(wd.temperatureC) && isnan(s_last.temperatureC));
     const bool changed =
-        (wd.id != s_lastId) ||
-        (wd.dt != s_lastDt) ||
-        (wd.icon != s_lastIcon) ||
-        (wd.temperature != s_lastTemp) ||
-        (wd.condition != s_lastCond);
+        (wd.id != s_last.id) ||
+        (wd.dt != s_last.dt) ||
+        !sameTemp ||
+        strcmp(wd.icon, s_last.icon) != 0 ||
+        strcmp(wd.condition, s_last.condition) != 0;
 
     if(!changed) return;
-
-    s_lastId   = wd.id;
-    s_lastDt   = wd.dt;
-    s_lastIcon = wd.icon;
-    s_lastTemp = wd.temperature;
-    s_lastCond = wd.condition;
+    s_last = wd;
 
     // Background
     if(s_bg) {
-        const char* path = pick_bg(wd.id, wd.icon);
-        lv_image_set_src(s_bg, path);
+        ImageCache::instance().setSrc(s_bg, asset_path(pick_bg(wd.id, wd.icon)));
     }
 
     // Temp
     if(s_tempMain && s_tempShadow) {
-        lv_label_set_text(s_tempMain, wd.temperature.c_str());
+        char tempText[16];
+        lv_label_set_text(s_tempMain, weather_format_temp(wd, tempText, sizeof(tempText)));
         set_shadow_label_text(s_tempShadow, s_tempMain);
         lv_obj_align(s_tempMain, LV_ALIGN_CENTER, 0, -50);
         lv_obj_align_to(s_tempShadow, s_tempMain, LV_ALIGN_TOP_LEFT, 2, 2);
@@ -228,7 +235,7 @@ void ui_WeatherScreen_tick(void)
 
     // Condition
     if(s_condMain && s_condShadow) {
-        lv_label_set_text(s_condMain, wd.condition.c_str());
+        lv_label_set_text(s_condMain, wd.condition);
         set_shadow_label_text(s_condShadow, s_condMain);
         lv_obj_align_to(s_condMain, s_tempMain, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
         lv_obj_align_to(s_condShadow, s_condMain, LV_ALIGN_TOP_LEFT, 2, 2);
@@ -292,33 +299,38 @@ switch(seg) {
 }
 
 // ---------- Background mapping ----------
-static const char* pick_bg(uint16_t id, const String& icon)
+static AssetId pick_bg(uint16_t id, const char* icon)
 {
     // OpenWeather icon codes are like "01d", "02n"
-    const bool night = (icon.length() >= 3 && icon.charAt(2) == 'n');
+    const bool night = (icon && strlen(icon) >= 3 && icon[2] == 'n');
 
-    if(id == 800) return night ? "A:/lvgl/weather/clear-night-bg.jpg" : "A:/lvgl/weather/clear-day-bg.jpg";
-    if(id == 801) return night ? "A:/lvgl/weather/patchy-night-bg.jpg" : "A:/lvgl/weather/patchy-day-bg.jpg";
-    if(id == 802 || id == 803 || id == 804) return "A:/lvgl/weather/cloudy-bg.jpg";
+    if(id == 800) return night ? ASSET_WEATHER_CLEAR_NIGHT_BG : ASSET_WEATHER_CLEAR_DAY_BG;
+    if(id == 801) return night ? ASSET_WEATHER_PARTLY_CLOUDY_NIGHT_BG : ASSET_WEATHER_PARTLY_CLOUDY_DAY_BG;
+    if(id == 802 || id == 803 || id == 804) return ASSET_WEATHER_CLOUDY_BG;
 
-    if(id / 100 == 2) return "A:/lvgl/weather/thunder-bg.jpg";
-    if(id / 100 == 3) return "A:/lvgl/weather/drizzle-bg.jpg";
+    if(id / 100 == 2) return ASSET_WEATHER_THUNDERSTORM_BG;
+    if(id / 100 == 3) return ASSET_WEATHER_DRIZZLE_BG;
 
     if(id / 100 == 5) {
-        if(id == 500) return "A:/lvgl/weather/light-rain-bg.jpg";
-        return "A:/lvgl/weather/rain-bg.jpg";
+        if(id == 500) return ASSET_WEATHER_LIGHT_RAIN_BG;
+        return ASSET_WEATHER_HEAVY_RAIN_BG;
     }
 
     if(id / 100 == 6) {
         // 611-616 are sleet-ish in OWM
-        if(id >= 611 && id <= 616) return "A:/lvgl/weather/sleet-bg.jpg";
-        return "A:/lvgl/weather/snow-bg.jpg";
+        if(id >= 611 && id <= 616) return ASSET_WEATHER_SLEET_BG;
+        return ASSET_WEATHER_SNOW_BG;
     }
 
-    if(id / 100 == 7) return "A:/lvgl/weather/fog-bg.jpg";
+    if(id / 100 == 7) return ASSET_WEATHER_FOG_BG;
 
     // fallback
-    return "A:/lvgl/weather/cloudy-bg.jpg";
+    return ASSET_WEATHER_CLOUDY_BG;
+}
+
+const char* ui_WeatherScreen_bg_path(uint16_t id, const char* icon)
+{
+    return asset_path(pick_bg(id, icon));
 }
 
 static const char* pick_label_for_arc_value(int v)
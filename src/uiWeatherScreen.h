@@ -8,8 +8,12 @@ extern "C" {
 extern lv_obj_t * ui_WeatherScreen;
 
 void ui_WeatherScreen_screen_init(void);
+void ui_WeatherScreen_screen_destroy(void);
 void ui_WeatherScreen_tick(void);
 
+// Background the Weather screen will show for this condition (for prefetching)
+const char* ui_WeatherScreen_bg_path(uint16_t id, const char* icon);
+
 #ifdef __cplusplus
 }
 #endif
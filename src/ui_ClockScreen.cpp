@@ -7,6 +7,13 @@
 #include "clock.h" // Include clock.h to access clock data
 //#include "audio_bridge.h"
 #include "AlarmManager.h"   // or whatever you named it
+#include "NeedleSprites.h"
+#include "ImageCache.h"
+#include "AssetManifest.h"
+#include "PowerManager.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <sys/time.h>
 #include <math.h>
 #include "athelas_48_roman.c"
 
@@ -18,7 +25,89 @@
 lv_obj_t * clock_scale;
 //lv_obj_t * hour_hand_img;
 //lv_obj_t * minute_hand_img;
-lv_obj_t * second_hand_line;
+// Second hand, split into short segments. Each is an lv_line sized to its own
+// bounding box, so a tick only invalidates a strip of boxes hugging the old and
+// new needle instead of a line object that spans half the dial.
+#define SECOND_HAND_SEGMENTS 4
+#define SECOND_HAND_LENGTH   140
+static lv_obj_t * second_hand_segs[SECOND_HAND_SEGMENTS];
+static lv_point_precise_t second_hand_pts[SECOND_HAND_SEGMENTS][2];
+
+// Needle pivots inside the source bitmaps (hour_hand.c / minute_hand.c)
+#define HOUR_HAND_PIVOT_X   0
+#define HOUR_HAND_PIVOT_Y   6
+#define MINUTE_HAND_PIVOT_X 0
+#define MINUTE_HAND_PIVOT_Y 5
+
+// Sweep mode: the second hand glides at the display refresh rate instead of
+// ticking. Only affordable because a frame invalidates just the few boxes
+// around the needle. Falls back to 1 Hz ticks when rendering can't keep up
+// or the battery is low.
+#define SWEEP_PERIOD_MS        LV_DEF_REFR_PERIOD
+#define SWEEP_BUDGET_PCT       60      // render may use this much of a frame period
+#define SWEEP_BACKOFF_MS       10000   // stay at 1 Hz this long after an overrun
+#define SWEEP_LOW_BATTERY_PCT  20
+
+static bool         sweep_enabled     = false;
+static lv_timer_t * sweep_timer       = nullptr;
+static uint32_t     sweep_backoff_until = 0;
+static int64_t      render_start_us   = 0;
+static uint32_t     render_avg_us     = 0;   // EMA of render time, 1/8 weight
+static int32_t      second_tip_x      = INT32_MIN;
+static int32_t      second_tip_y      = INT32_MIN;
+
+// Static face layer: the Roman numeral ring (12 arclabels laying glyphs out
+// along an arc), the separator rings and the scale's ticks + rotated second
+// labels are rendered once into an ARGB8888 image in PSRAM and drawn as one
+// blit. The live clock_scale keeps its geometry (the needles hang off it) but
+// draws nothing. Only re-rendered when the numeral font or radius changes.
+#define CLOCK_FACE_LAYER      1
+#define ROMAN_RADIUS_DEFAULT  180   // centre of the letters; 195-205 to fine-tune
+
+struct ClockFaceLayer {
+    lv_draw_buf_t     buf;
+    uint8_t *         data;
+    uint32_t          cap;
+    const lv_font_t * font;     // what the current pixels were rendered with
+    int32_t           radius;
+};
+
+static ClockFaceLayer    face_layer       = {};
+static lv_obj_t *        face_layer_img   = nullptr;
+static bool              face_layer_ready = false;
+static const lv_font_t * roman_font       = &athelas_48_roman;
+static int32_t           roman_radius     = ROMAN_RADIUS_DEFAULT;
+
+// Last values pushed to the needles; -1 forces the first update
+static int     shown_second = -1;
+static int32_t shown_minute_angle = -1;
+static int32_t shown_hour_angle   = -1;
+
+// Needle angles in 0.1°, 0 = pointing right (the bitmaps' rest pose), so
+// 12 o'clock is 2700. The hour hand creeps 0.5° per minute.
+static int32_t hour_needle_angle(int hour, int minute)
+{
+    return (2700 + (hour % 12) * 300 + minute * 5) % 3600;
+}
+
+static int32_t minute_needle_angle(int minute)
+{
+    return (2700 + minute * 60) % 3600;
+}
+
+static void place_hour_needle(lv_obj_t * img, int32_t angle10)
+{
+    needle_sprite_place(img, &hour_hand, HOUR_HAND_PIVOT_X, HOUR_HAND_PIVOT_Y, angle10,
+                        lv_obj_get_content_width(clock_scale) / 2,
+                        lv_obj_get_content_height(clock_scale) / 2);
+}
+
+static void place_minute_needle(lv_obj_t * img, int32_t angle10)
+{
+    needle_sprite_place(img, &minute_hand, MINUTE_HAND_PIVOT_X, MINUTE_HAND_PIVOT_Y, angle10,
+                        lv_obj_get_content_width(clock_scale) / 2,
+                        lv_obj_get_content_height(clock_scale) / 2);
+}
 lv_obj_t * alarm_hour_hand_img;
 lv_obj_t * alarm_minute_hand_img;
 lv_obj_t * alarm_bell_img;
@@ -41,6 +130,149 @@ static void alarm_min_tap_cb(lv_event_t * e);
 static void alarm_adjust_minutes(int delta);
 static lv_style_t style_roman;
 
+static void second_hand_create(lv_obj_t * parent)
+{
+    for (int i = 0; i < SECOND_HAND_SEGMENTS; i++) {
+        lv_obj_t * seg = lv_line_create(parent);
+        lv_line_set_points(seg, second_hand_pts[i], 2);
+        lv_obj_set_style_line_width(seg, 2, 0);
+        lv_obj_set_style_line_color(seg, lv_palette_main(LV_PALETTE_RED), 0);
+        lv_obj_set_style_line_rounded(seg, true, 0);
+        lv_obj_clear_flag(seg, LV_OBJ_FLAG_CLICKABLE);
+        second_hand_segs[i] = seg;
+    }
+}
+
+// Same geometry lv_scale_set_line_needle_value() used: centre of the scale,
+// 0 at 12 o'clock (rotation 270), 6° per second. `seconds` may be fractional.
+static void second_hand_set(float seconds)
+{
+    const int32_t cx = lv_obj_get_content_width(clock_scale) / 2;
+    const int32_t cy = lv_obj_get_content_height(clock_scale) / 2;
+    const float   angle = (270.0f + seconds * 6.0f) * (float)M_PI / 180.0f;
+    const int32_t dx = (int32_t)lroundf(cosf(angle) * SECOND_HAND_LENGTH);
+    const int32_t dy = (int32_t)lroundf(sinf(angle) * SECOND_HAND_LENGTH);
+
+    // Sub-pixel moves would only re-render the same pixels
+    if (dx == second_tip_x && dy == second_tip_y) return;
+    second_tip_x = dx;
+    second_tip_y = dy;
+
+    for (int i = 0; i < SECOND_HAND_SEGMENTS; i++) {
+        const int32_t x0 = cx + dx * i / SECOND_HAND_SEGMENTS;
+        const int32_t y0 = cy + dy * i / SECOND_HAND_SEGMENTS;
+        const int32_t x1 = cx + dx * (i + 1) / SECOND_HAND_SEGMENTS;
+        const int32_t y1 = cy + dy * (i + 1) / SECOND_HAND_SEGMENTS;
+        const int32_t ox = LV_MIN(x0, x1);
+        const int32_t oy = LV_MIN(y0, y1);
+
+        second_hand_pts[i][0].x = x0 - ox;
+        second_hand_pts[i][0].y = y0 - oy;
+        second_hand_pts[i][1].x = x1 - ox;
+        second_hand_pts[i][1].y = y1 - oy;
+
+        lv_obj_t * seg = second_hand_segs[i];
+        lv_line_set_points(seg, second_hand_pts[i], 2);
+        lv_obj_set_pos(seg, ox, oy);
+        lv_obj_set_size(seg, LV_ABS(x1 - x0) + 1, LV_ABS(y1 - y0) + 1);
+    }
+}
+
+static bool sweep_capped(void)
+{
+    if ((int32_t)(lv_tick_get() - sweep_backoff_until) < 0) return true;
+
+    const PowerManager::PowerState ps = PowerManager::instance().state();
+    return ps.batteryConnected && !ps.externalPowerPresent &&
+           ps.batteryPercent < SWEEP_LOW_BATTERY_PCT;
+}
+
+// Display render start/ready: keeps a running average of how long a frame takes
+// to render so the sweep can back off before it starves everything else.
+static void sweep_render_event_cb(lv_event_t * e)
+{
+    const int64_t now = esp_timer_get_time();
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        render_start_us = now;
+        return;
+    }
+    if (!render_start_us) return;
+    const uint32_t us = (uint32_t)(now - render_start_us);
+    render_avg_us = render_avg_us ? render_avg_us - render_avg_us / 8 + us / 8 : us;
+}
+
+static void sweep_timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+    if (lv_scr_act() != ui_ClockScreen) return;
+
+    if (render_avg_us > (uint32_t)SWEEP_PERIOD_MS * 10 * SWEEP_BUDGET_PCT) {
+        Serial.printf("[Clock] sweep over budget (%lu us/frame), ticking at 1 Hz for %d s\n",
+                      (unsigned long)render_avg_us, SWEEP_BACKOFF_MS / 1000);
+        sweep_backoff_until = lv_tick_get() + SWEEP_BACKOFF_MS;
+        render_avg_us = 0;
+    }
+
+    if (sweep_capped()) {
+        // Let update_clock_screen() tick it; snap to the whole second
+        if (second_value != shown_second) {
+            second_hand_set((float)second_value);
+            shown_second = second_value;
+        }
+        return;
+    }
+
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    struct tm tmv;
+    time_t secs = tv.tv_sec;
+    localtime_r(&secs, &tmv);
+    second_hand_set((float)tmv.tm_sec + (float)tv.tv_usec / 1000000.0f);
+    shown_second = -1;   // hand is between ticks now
+}
+
+// Only run the sweep timer while the clock is on screen, so other screens can
+// still idle between LVGL deadlines.
+static void sweep_screen_event_cb(lv_event_t * e)
+{
+    if (!sweep_timer) return;
+    if (lv_event_get_code(e) == LV_EVENT_SCREEN_LOADED) {
+        lv_timer_resume(sweep_timer);
+    } else {
+        lv_timer_pause(sweep_timer);
+    }
+}
+
+void clock_screen_set_sweep(bool enabled)
+{
+    if (enabled == sweep_enabled) return;
+    sweep_enabled = enabled;
+
+    if (enabled) {
+        static bool render_cb_added = false;
+        if (!render_cb_added) {
+            lv_display_t * disp = lv_display_get_default();
+            lv_display_add_event_cb(disp, sweep_render_event_cb, LV_EVENT_RENDER_START, nullptr);
+            lv_display_add_event_cb(disp, sweep_render_event_cb, LV_EVENT_RENDER_READY, nullptr);
+            render_cb_added = true;
+        }
+        render_avg_us = 0;
+        sweep_backoff_until = lv_tick_get();
+        sweep_timer = lv_timer_create(sweep_timer_cb, SWEEP_PERIOD_MS, nullptr);
+        if (lv_scr_act() != ui_ClockScreen) lv_timer_pause(sweep_timer);
+    } else {
+        if (sweep_timer) lv_timer_delete(sweep_timer);
+        sweep_timer = nullptr;
+        shown_second = -1;   // re-snap on the next tick
+    }
+    Serial.printf("[Clock] sweep second hand %s\n", enabled ? "on" : "off");
+}
+
+bool clock_screen_sweep_enabled(void)
+{
+    return sweep_enabled;
+}
+
 void init_roman_style(void)
 {
     lv_style_init(&style_roman);
@@ -49,7 +281,7 @@ void init_roman_style(void)
     lv_style_set_bg_opa(&style_roman, LV_OPA_TRANSP);
 }
 
-static void create_roman_numbers(lv_obj_t *parent)
+static void create_roman_numbers(lv_obj_t *parent, const lv_font_t *font, int32_t radius)
 {
     /* Roman strings starting at 12 o'clock and going clockwise */
     static const char *romans[12] = {
@@ -60,10 +292,6 @@ static void create_roman_numbers(lv_obj_t *parent)
     const int32_t cx = 466 / 2;
     const int32_t cy = 466 / 2;
 
-    /* Radius where the centre of the letters should sit. 
-       Adjust this a bit to match your ring layout. */
-    const uint32_t R_TEXT = 180;   // try 195–205 to fine-tune
-
     for (int i = 0; i < 12; i++) {
         lv_obj_t *al = lv_arclabel_create(parent);
 
@@ -72,12 +300,12 @@ static void create_roman_numbers(lv_obj_t *parent)
         lv_obj_set_size(al, 466, 466);
         lv_obj_center(al);
 
-        lv_obj_set_style_text_font(al, &athelas_48_roman, LV_PART_MAIN);
+        lv_obj_set_style_text_font(al, font, LV_PART_MAIN);
         lv_obj_set_style_text_color(al, lv_color_black(), LV_PART_MAIN);
         lv_obj_set_style_bg_opa(al, LV_OPA_TRANSP, LV_PART_MAIN);
 
         lv_arclabel_set_text(al, romans[i]);
-        lv_arclabel_set_radius(al, R_TEXT);
+        lv_arclabel_set_radius(al, radius);
 
         /* text should flow along the dial in the clockwise direction */
         lv_arclabel_set_dir(al, LV_ARCLABEL_DIR_CLOCKWISE);
@@ -126,16 +354,147 @@ static lv_obj_t *make_ring(lv_obj_t *parent, int size, int width, lv_color_t col
 }
 
 
-void create_clockface_circles(void)
+void create_clockface_circles(lv_obj_t *parent)
 {
     // Outer separator near tick indicators
-    make_ring(ui_ClockScreen, 435, 2, lv_color_hex(0x000000));
+    make_ring(parent, 435, 2, lv_color_hex(0x000000));
 
     // Between ticks and numerals
-    make_ring(ui_ClockScreen, 285, 1, lv_color_hex(0x000000));
+    make_ring(parent, 285, 1, lv_color_hex(0x000000));
 
     // Inside numerals
-    make_ring(ui_ClockScreen, 315, 2, lv_color_hex(0x000000));
+    make_ring(parent, 315, 2, lv_color_hex(0x000000));
+}
+
+// Ticks, labels and geometry of the dial scale, shared by the live scale and
+// the one rendered into the face layer so they line up exactly
+static void setup_clock_scale(lv_obj_t *scale)
+{
+    // Make sure the scale does NOT paint a background
+    lv_obj_set_style_bg_opa(scale, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_style_border_opa(scale, LV_OPA_TRANSP, LV_PART_MAIN);
+    // Last added part
+
+    lv_obj_set_size(scale, 410, 410);
+    lv_obj_center(scale);
+    lv_scale_set_mode(scale, LV_SCALE_MODE_ROUND_OUTER);
+    //lv_obj_set_style_bg_opa(scale, 255, 0);
+
+    lv_obj_set_style_radius(scale, LV_RADIUS_CIRCLE, 0);
+
+    // --- tick & label setup for 5-second intervals ---
+    lv_scale_set_label_show(scale, true);
+    lv_scale_set_total_tick_count(scale, 61);   // 0–60 inclusive
+    lv_scale_set_major_tick_every(scale, 5);    // every 5 = major tick
+    lv_scale_set_range(scale, 0, 60);
+    lv_scale_set_angle_range(scale, 360);
+    lv_scale_set_rotation(scale, 270);          // 0/60 at 12 o’clock
+
+    // Custom text labels: top is 60, skip duplicate at 60
+    static const char *  five_sec_labels[] = {
+        "60", "5", "10", "15", "20", "25", "30",
+        "35", "40", "45", "50", "55", "", NULL
+    };
+    lv_scale_set_text_src(scale, five_sec_labels);
+
+    // -------- Style section --------
+
+    // --- Minor ticks (1-second marks) ---
+    lv_obj_set_style_line_width(scale, 1, LV_PART_ITEMS);      // thin
+    lv_obj_set_style_length(scale, 10, LV_PART_ITEMS);          // short
+    lv_obj_set_style_line_color(scale, lv_color_hex(0x303030), LV_PART_ITEMS);
+    lv_obj_set_style_line_opa(scale, LV_OPA_100, LV_PART_ITEMS);
+
+    // --- Major ticks (5-second marks) ---
+    lv_obj_set_style_line_width(scale, 5, LV_PART_INDICATOR);  // thicker
+    lv_obj_set_style_length(scale, 10, LV_PART_INDICATOR);     // longer
+    lv_obj_set_style_line_color(scale, lv_color_hex(0x000000), LV_PART_INDICATOR);
+    lv_obj_set_style_line_opa(scale, LV_OPA_COVER, LV_PART_INDICATOR);
+
+    // --- Label text (shares LV_PART_INDICATOR) ---
+    lv_obj_set_style_text_color(scale, lv_color_hex(0x4169E1), LV_PART_INDICATOR); // Royal Blue
+    lv_obj_set_style_text_opa(scale, LV_OPA_COVER, LV_PART_INDICATOR);
+    lv_obj_set_style_pad_radial(scale, -5, LV_PART_INDICATOR);
+
+    // Rotate labels to match tick angle (no KEEP_UPRIGHT -> bottom labels are upside-down)
+    lv_obj_set_style_transform_rotation(scale, LV_SCALE_LABEL_ROTATE_MATCH_TICKS + 900, LV_PART_INDICATOR);
+    // Apply an extra rotation offset of -90° (units = 0.1°)
+  //  lv_obj_set_style_transform_angle(scale, 0, LV_PART_INDICATOR);
+    // If that flips the wrong way on your build, use +900 instead.
+
+
+    // Fine-tune spacing of labels
+   // lv_obj_set_style_pad_all(scale, 4, LV_PART_INDICATOR);
+
+    lv_scale_set_range(scale, 0, 60);
+    lv_scale_set_angle_range(scale, 360);
+    lv_scale_set_rotation(scale, 270); // Start at the top
+}
+
+static bool face_layer_snapshot(lv_obj_t *obj)
+{
+    lv_obj_update_layout(obj);
+    const int32_t  w      = lv_obj_get_width(obj);
+    const int32_t  h      = lv_obj_get_height(obj);
+    const uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888);
+    const uint32_t size   = stride * h;
+
+    if (face_layer.cap < size) {
+        if (face_layer.data) heap_caps_free(face_layer.data);
+        face_layer.data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        face_layer.cap  = face_layer.data ? size : 0;
+        if (!face_layer.data) {
+            Serial.printf("[Clock] face layer: no PSRAM for %u bytes\n", (unsigned)size);
+            return false;
+        }
+    }
+
+    lv_draw_buf_init(&face_layer.buf, w, h, LV_COLOR_FORMAT_ARGB8888, stride, face_layer.data, size);
+    return lv_snapshot_take_to_draw_buf(obj, LV_COLOR_FORMAT_ARGB8888, &face_layer.buf) == LV_RESULT_OK;
+}
+
+// Render numerals, rings and scale on a transparent scratch screen that is
+// never loaded. Skipped when the cached pixels already match font + radius.
+static bool render_face_layer(void)
+{
+    if (face_layer.data && face_layer.font == roman_font && face_layer.radius == roman_radius) {
+        return true;
+    }
+
+    const uint32_t t0 = millis();
+    lv_obj_t *scratch = lv_obj_create(NULL);
+    lv_obj_clear_flag(scratch, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(scratch, 466, 466);
+    lv_obj_set_style_bg_opa(scratch, LV_OPA_TRANSP, LV_PART_MAIN);
+
+    create_roman_numbers(scratch, roman_font, roman_radius);
+    create_clockface_circles(scratch);
+    lv_obj_t *scale = lv_scale_create(scratch);
+    setup_clock_scale(scale);
+
+    const bool ok = face_layer_snapshot(scratch);
+    lv_obj_delete(scratch);
+    if (!ok) return false;
+
+    lv_image_cache_drop(&face_layer.buf);
+    face_layer.font   = roman_font;
+    face_layer.radius = roman_radius;
+    Serial.printf("[Clock] face layer rendered in %lu ms\n", (unsigned long)(millis() - t0));
+    return true;
+}
+
+void clock_screen_set_roman_ring(const lv_font_t *font, int32_t radius)
+{
+    roman_font   = font ? font : &athelas_48_roman;
+    roman_radius = radius > 0 ? radius : ROMAN_RADIUS_DEFAULT;
+
+    // Live arclabels (no layer) pick this up when the screen is next built
+    if (!face_layer_ready) return;
+    if (!render_face_layer()) {
+        Serial.println("[Clock] face layer re-render failed");
+        return;
+    }
+    if (face_layer_img) lv_obj_invalidate(face_layer_img);
 }
 
 void ui_ClockScreen_screen_init(void) {
@@ -161,8 +520,19 @@ void ui_ClockScreen_screen_init(void) {
 
 
 
-  create_roman_numbers(ui_ClockScreen);
-    create_clockface_circles();
+#if CLOCK_FACE_LAYER
+    face_layer_ready = render_face_layer();
+#endif
+    if (face_layer_ready) {
+        face_layer_img = lv_image_create(ui_ClockScreen);
+        lv_image_set_src(face_layer_img, &face_layer.buf);
+        lv_obj_center(face_layer_img);
+        lv_obj_clear_flag(face_layer_img, LV_OBJ_FLAG_CLICKABLE);
+    } else {
+        Serial.println("[Clock] face layer unavailable, drawing numerals live");
+        create_roman_numbers(ui_ClockScreen, roman_font, roman_radius);
+        create_clockface_circles(ui_ClockScreen);
+    }
 
 /////////////////////////////////////
     // Main Arc Menu
@@ -197,92 +567,33 @@ lv_obj_set_style_border_opa(ui_MainArcClockMenu, LV_OPA_TRANSP, LV_PART_MAIN);
     // Create the scale (clock face)
     clock_scale = lv_scale_create(ui_ClockScreen);
     lv_obj_clear_flag(clock_scale, LV_OBJ_FLAG_CLICKABLE);
+    setup_clock_scale(clock_scale);
 
-    // Make sure the scale does NOT paint a background
-    lv_obj_set_style_bg_opa(clock_scale, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_opa(clock_scale, LV_OPA_TRANSP, LV_PART_MAIN);
-    // Last added part
-
-    lv_obj_set_size(clock_scale, 410, 410);
-    lv_obj_center(clock_scale);
-    lv_scale_set_mode(clock_scale, LV_SCALE_MODE_ROUND_OUTER);
-    //lv_obj_set_style_bg_opa(clock_scale, 255, 0);
-
-    lv_obj_set_style_radius(clock_scale, LV_RADIUS_CIRCLE, 0);
-
-    // --- tick & label setup for 5-second intervals ---
-    lv_scale_set_label_show(clock_scale, true);
-    lv_scale_set_total_tick_count(clock_scale, 61);   // 0–60 inclusive
-    lv_scale_set_major_tick_every(clock_scale, 5);    // every 5 = major tick
-    lv_scale_set_range(clock_scale, 0, 60);
-    lv_scale_set_angle_range(clock_scale, 360);
-    lv_scale_set_rotation(clock_scale, 270);          // 0/60 at 12 o’clock
-
-    // Custom text labels: top is 60, skip duplicate at 60
-    static const char *  five_sec_labels[] = {
-        "60", "5", "10", "15", "20", "25", "30",
-        "35", "40", "45", "50", "55", "", NULL
-    };
-    lv_scale_set_text_src(clock_scale, five_sec_labels);
-
-    // -------- Style section --------
-
-    // --- Minor ticks (1-second marks) ---
-    lv_obj_set_style_line_width(clock_scale, 1, LV_PART_ITEMS);      // thin
-    lv_obj_set_style_length(clock_scale, 10, LV_PART_ITEMS);          // short
-    lv_obj_set_style_line_color(clock_scale, lv_color_hex(0x303030), LV_PART_ITEMS);
-    lv_obj_set_style_line_opa(clock_scale, LV_OPA_100, LV_PART_ITEMS);
-
-    // --- Major ticks (5-second marks) ---
-    lv_obj_set_style_line_width(clock_scale, 5, LV_PART_INDICATOR);  // thicker
-    lv_obj_set_style_length(clock_scale, 10, LV_PART_INDICATOR);     // longer
-    lv_obj_set_style_line_color(clock_scale, lv_color_hex(0x000000), LV_PART_INDICATOR);
-    lv_obj_set_style_line_opa(clock_scale, LV_OPA_COVER, LV_PART_INDICATOR);
-
-    // --- Label text (shares LV_PART_INDICATOR) ---
-    lv_obj_set_style_text_color(clock_scale, lv_color_hex(0x4169E1), LV_PART_INDICATOR); // Royal Blue
-    lv_obj_set_style_text_opa(clock_scale, LV_OPA_COVER, LV_PART_INDICATOR);
-    lv_obj_set_style_pad_radial(clock_scale, -5, LV_PART_INDICATOR);
-
-    // Rotate labels to match tick angle (no KEEP_UPRIGHT -> bottom labels are upside-down)
-    lv_obj_set_style_transform_rotation(clock_scale, LV_SCALE_LABEL_ROTATE_MATCH_TICKS + 900, LV_PART_INDICATOR);
-    // Apply an extra rotation offset of -90° (units = 0.1°)
-  //  lv_obj_set_style_transform_angle(clock_scale, 0, LV_PART_INDICATOR);
-    // If that flips the wrong way on your build, use +900 instead.
-
-
-    // Fine-tune spacing of labels
-   // lv_obj_set_style_pad_all(clock_scale, 4, LV_PART_INDICATOR);
+    if (face_layer_ready) {
+        // Ticks and labels are in the face layer; keep the scale as the needle frame
+        lv_scale_set_label_show(clock_scale, false);
+        lv_obj_set_style_line_opa(clock_scale, LV_OPA_TRANSP, LV_PART_ITEMS);
+        lv_obj_set_style_line_opa(clock_scale, LV_OPA_TRANSP, LV_PART_INDICATOR);
+    }
 
-    lv_scale_set_range(clock_scale, 0, 60);
-    lv_scale_set_angle_range(clock_scale, 360);
-    lv_scale_set_rotation(clock_scale, 270); // Start at the top
-    
-  
-    
     // Create hour hand image
     hour_hand_img = lv_img_create(clock_scale);
     lv_img_set_src(hour_hand_img, &hour_hand);
     //lv_obj_center(hour_hand_img);
-    lv_img_set_pivot(hour_hand_img, 0, 6);
-    lv_obj_align(hour_hand_img, LV_ALIGN_CENTER, 41, 0);
-    lv_img_set_angle(hour_hand_img, 0);
+    lv_obj_set_align(hour_hand_img, LV_ALIGN_TOP_LEFT);   // placed by needle_sprite_place()
 
     // Create minute hand image
     minute_hand_img = lv_img_create(clock_scale);
     lv_img_set_src(minute_hand_img, &minute_hand);
     //lv_obj_center(minute_hand_img);
-    lv_img_set_pivot(minute_hand_img, 0, 5);
-    lv_obj_align(minute_hand_img, LV_ALIGN_CENTER, 54, 0);
-    lv_img_set_angle(minute_hand_img, 0);
+    lv_obj_set_align(minute_hand_img, LV_ALIGN_TOP_LEFT);
   
 
      // --- Alarm ghost hands (hidden by default) ---
 
     alarm_hour_hand_img = lv_img_create(clock_scale);
     lv_img_set_src(alarm_hour_hand_img, &hour_hand);
-    lv_img_set_pivot(alarm_hour_hand_img, 0, 6);
-    lv_obj_align(alarm_hour_hand_img, LV_ALIGN_CENTER, 41, 0);
+    lv_obj_set_align(alarm_hour_hand_img, LV_ALIGN_TOP_LEFT);
     lv_obj_set_style_img_opa(alarm_hour_hand_img, LV_OPA_40, LV_PART_MAIN);
     lv_obj_add_flag(alarm_hour_hand_img, LV_OBJ_FLAG_HIDDEN);
         // Allow tapping the ghost hands
@@ -294,8 +605,7 @@ lv_obj_set_style_border_opa(ui_MainArcClockMenu, LV_OPA_TRANSP, LV_PART_MAIN);
 
     alarm_minute_hand_img = lv_img_create(clock_scale);
     lv_img_set_src(alarm_minute_hand_img, &minute_hand);
-    lv_img_set_pivot(alarm_minute_hand_img, 0, 5);
-    lv_obj_align(alarm_minute_hand_img, LV_ALIGN_CENTER, 54, 0);
+    lv_obj_set_align(alarm_minute_hand_img, LV_ALIGN_TOP_LEFT);
     lv_obj_set_style_img_opa(alarm_minute_hand_img, LV_OPA_40, LV_PART_MAIN);
     lv_obj_add_flag(alarm_minute_hand_img, LV_OBJ_FLAG_HIDDEN);
     // Drag on the dial to set minutes by angle
@@ -316,10 +626,10 @@ lv_obj_set_style_border_opa(ui_MainArcClockMenu, LV_OPA_TRANSP, LV_PART_MAIN);
 
     // The bell image as a child (visual only)
     alarm_bell_img = lv_img_create(alarm_bell_hit);
-    lv_img_set_src(alarm_bell_img, "A:/lvgl/img/bell_icon.png");
+    // Pre-scaled to its on-screen size by scripts/lvgl_assets.py, so no zoom here
+    ImageCache::instance().setSrc(alarm_bell_img, asset_path(ASSET_IMG_BELL_ICON));
     //lv_obj_set_style_bg_opa(alarm_bell_hit, LV_OPA_TRANSP, 0);
     lv_obj_center(alarm_bell_img);
-    lv_obj_set_style_transform_zoom(alarm_bell_img, 150, LV_PART_MAIN); // 75%
 
     // Click handler on the BIG hit target, not the image
     lv_obj_add_event_cb(alarm_bell_hit, alarm_bell_event_cb, LV_EVENT_CLICKED, nullptr);
@@ -345,17 +655,10 @@ lv_obj_set_style_border_opa(ui_MainArcClockMenu, LV_OPA_TRANSP, LV_PART_MAIN);
 
 
 
-  // Create second hand line
-    second_hand_line = lv_line_create(clock_scale);
-    // Define points for the second hand line
-    static lv_point_precise_t second_hand_points[] = {{0, 0}, {0, 90}}; // Adjust length as needed
-    lv_line_set_points(second_hand_line, second_hand_points, 2);
-    lv_obj_center(second_hand_line);
-    lv_obj_set_style_line_width(second_hand_line, 2, 0);
-    lv_obj_set_style_line_color(second_hand_line, lv_palette_main(LV_PALETTE_RED), 0);
-    lv_obj_set_style_line_rounded(second_hand_line, true, 0);
-    lv_obj_set_style_transform_pivot_x(second_hand_line, 0, 0);
-    lv_obj_set_style_transform_pivot_y(second_hand_line, 0, 0); 
+  // Create second hand
+    second_hand_create(clock_scale);
+    lv_obj_add_event_cb(ui_ClockScreen, sweep_screen_event_cb, LV_EVENT_SCREEN_LOADED, nullptr);
+    lv_obj_add_event_cb(ui_ClockScreen, sweep_screen_event_cb, LV_EVENT_SCREEN_UNLOADED, nullptr);
    
    // Create a circle dot to cover the middle.
 
@@ -374,6 +677,14 @@ lv_obj_set_style_border_opa(ui_MainArcClockMenu, LV_OPA_TRANSP, LV_PART_MAIN);
 
     alarm_update_bell_style();
 
+    // Fresh objects: make the next update push every needle
+    needle_sprites_reset();
+    second_tip_x       = INT32_MIN;
+    second_tip_y       = INT32_MIN;
+    shown_second       = -1;
+    shown_minute_angle = -1;
+    shown_hour_angle   = -1;
+
     // Call update to set initial positions
     update_clock_screen();
 }
@@ -398,18 +709,22 @@ void update_clock_screen(void) {
     int32_t second_angle = second_value * 6 * 10; // 6 degrees per second
     //printf("Setting hour hand value %d .\n", hour_value);
 
-    // Map the hour to the 0-60 scale
-float hour_base_value = hour_value * 5.0f; // Each hour corresponds to 5 units
-
-// Calculate the minute adjustment
-float minute_adjustment = (minute_value / 60.0f) * 5.0f; // Adjusts the hour hand based on minutes
-
-// Calculate the final hour value on the scale
-float hour_scale_value = hour_base_value + minute_adjustment;
-
-    lv_scale_set_image_needle_value(clock_scale, hour_hand_img, hour_scale_value);
-    lv_scale_set_image_needle_value(clock_scale, minute_hand_img, minute_value);
-    lv_scale_set_line_needle_value(clock_scale, second_hand_line, 140, second_value);
+    // Only touch a needle when its angle moved. The hour and minute hands are
+    // pre-rotated sprites (NeedleSprites), so a move is a blit, not a transform.
+    const int32_t hour_angle10   = hour_needle_angle(hour_value, minute_value);
+    const int32_t minute_angle10 = minute_needle_angle(minute_value);
+    if (hour_angle10 != shown_hour_angle) {
+        place_hour_needle(hour_hand_img, hour_angle10);
+        shown_hour_angle = hour_angle10;
+    }
+    if (minute_angle10 != shown_minute_angle) {
+        place_minute_needle(minute_hand_img, minute_angle10);
+        shown_minute_angle = minute_angle10;
+    }
+    if (!sweep_timer && second_value != shown_second) {
+        second_hand_set((float)second_value);
+        shown_second = second_value;
+    }
 
     // Set angles to the images
     //lv_img_set_angle(hour_hand_img, hour_angle);
@@ -495,12 +810,8 @@ static void alarm_update_ghost_needles(void)
     uint16_t hour24 = alarm_edit_minutes / 60u;
     uint16_t hour12 = hour24 % 12u;
 
-    float hour_base_value = hour12 * 5.0f;
-    float minute_adjustment = (min / 60.0f) * 5.0f;
-    float hour_scale_value = hour_base_value + minute_adjustment;
-
-    lv_scale_set_image_needle_value(clock_scale, alarm_hour_hand_img, hour_scale_value);
-    lv_scale_set_image_needle_value(clock_scale, alarm_minute_hand_img, (float)min);
+    place_hour_needle(alarm_hour_hand_img, hour_needle_angle(hour12, min));
+    place_minute_needle(alarm_minute_hand_img, minute_needle_angle(min));
 }
 
 static void alarm_adjust_minutes(int delta)
@@ -5,6 +5,15 @@
 
 void ui_ClockScreen_screen_init(void);
 void update_clock_screen(void);
+
+// Sweeping (refresh-rate) second hand instead of 1 Hz ticks. Drops back to
+// ticking by itself when frames run over budget or the battery is low.
+void clock_screen_set_sweep(bool enabled);
+bool clock_screen_sweep_enabled(void);
+
+// Font and radius of the Roman numeral ring. The cached face layer is only
+// re-rendered when these actually change. Call with the LVGL lock held.
+void clock_screen_set_roman_ring(const lv_font_t *font, int32_t radius);
 static void alarm_stop_bubble_cb(lv_event_t * e);
 static void alarm_update_bell_style(void);
 static void alarm_bell_longpress_cb(lv_event_t * e);
\ No newline at end of file
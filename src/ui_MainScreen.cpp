@@ -5,6 +5,7 @@
 #include <lvgl.h>
 #include "esp_heap_caps.h" // Include this header for heap_caps_malloc
 #include "WeatherManager.h"
+#include "WeatherIcons.h"
 
 #include <time.h>
 
@@ -79,7 +80,6 @@ void ui_mainscreen_set_tide_curve(const float *heights,
 #define CANVAS_WIDTH  466
 #define CANVAS_HEIGHT 466
 
-extern const char* getMeteoconIcon(uint16_t weatherId, bool day);
 
 static int16_t norm_angle_deg(float a)
 {
@@ -88,16 +88,157 @@ static int16_t norm_angle_deg(float a)
     return (int16_t)(a + 0.5f);
 }
 
+// --- Pre-rendered static face layer ---
+//
+// The gradient, the tick scale, the two mid rings and the empty arc tracks never
+// change, but as live widgets they were redrawn under every dirty rect - and the
+// MULTIPLY-blended scale forces LVGL to build a blend layer each time. Instead we
+// render them once into an RGB565 image in PSRAM and put that at the bottom of the
+// screen. Only rebuild it when the face colours/geometry change.
+//
+// Over the dark background the multiplied ticks are nearly black; where they really
+// show is where they cut into the seconds arc. That arc therefore gets its own
+// texture (indicator colour with the ticks multiplied in) used as arc_image_src.
+#define MAIN_STATIC_LAYER 1
+
+static constexpr uint32_t FACE_TRACK_COLOR  = 0x01070f;  // empty arc tracks + gradient top
+static constexpr uint32_t FACE_RING_COLOR   = 0x103357;  // mid info rings
+static constexpr uint32_t SECOND_ARC_COLOR  = 0x0892fc;
+static constexpr int      SECOND_ARC_SIZE   = 450;
+
+struct FaceTexture {
+    lv_draw_buf_t buf;
+    uint8_t *     data;
+    uint32_t      cap;
+};
+
+static FaceTexture staticFace   = {};
+static FaceTexture secondArcTex = {};
+static lv_obj_t *  ui_MainStaticLayer = nullptr;
+static bool        staticLayerReady   = false;
+
+static void style_face_background(lv_obj_t * obj)
+{
+    lv_obj_set_style_bg_color(obj, lv_color_hex(FACE_TRACK_COLOR), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+}
+
+// Empty 360° track, drawn exactly like the MAIN part of the clock/battery arcs
+static void create_face_track(lv_obj_t * parent, int32_t size)
+{
+    lv_obj_t * arc = lv_arc_create(parent);
+    lv_obj_set_size(arc, size, size);
+    lv_obj_center(arc);
+    lv_arc_set_bg_angles(arc, 0, 360);
+    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+    lv_obj_set_style_arc_width(arc, 5, LV_PART_MAIN);
+    lv_obj_set_style_arc_color(arc, lv_color_hex(FACE_TRACK_COLOR), LV_PART_MAIN);
+    lv_obj_set_style_arc_opa(arc, 255, LV_PART_MAIN);
+    lv_obj_set_style_arc_rounded(arc, false, LV_PART_MAIN);
+    lv_obj_set_style_arc_opa(arc, 0, LV_PART_INDICATOR);
+}
+
+// Thin dark-blue ring used for the mid info ring and its outer boundary
+static lv_obj_t * create_mid_ring(lv_obj_t * parent, int32_t size)
+{
+    lv_obj_t * ring = lv_arc_create(parent);
+    lv_obj_set_size(ring, size, size);
+    lv_obj_center(ring);
+    lv_arc_set_bg_angles(ring, 0, 360);
+    lv_arc_set_rotation(ring, 270);
+    lv_arc_set_value(ring, 0);
+    lv_obj_remove_style(ring, NULL, LV_PART_KNOB);
+    lv_obj_clear_flag(ring, LV_OBJ_FLAG_CLICKABLE);
+
+    // Ring line style
+    lv_obj_set_style_arc_width(ring, 2, LV_PART_MAIN);
+    lv_obj_set_style_arc_color(ring, lv_color_hex(FACE_RING_COLOR), LV_PART_MAIN); // dark-ish blue
+    lv_obj_set_style_arc_opa(ring, 200, LV_PART_MAIN);
+
+    // Hide indicator completely
+    lv_obj_set_style_arc_width(ring, 0, LV_PART_INDICATOR);
+    lv_obj_set_style_arc_opa(ring, 0, LV_PART_INDICATOR);
+    return ring;
+}
+
+static bool face_snapshot(lv_obj_t * obj, FaceTexture & tex)
+{
+    lv_obj_update_layout(obj);
+    const int32_t  w      = lv_obj_get_width(obj);
+    const int32_t  h      = lv_obj_get_height(obj);
+    const uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    const uint32_t size   = stride * h;
+
+    if (tex.cap < size) {
+        if (tex.data) heap_caps_free(tex.data);
+        tex.data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        tex.cap  = tex.data ? size : 0;
+        if (!tex.data) {
+            Serial.printf("[MainScreen] static layer: no PSRAM for %u bytes\n", (unsigned)size);
+            return false;
+        }
+    }
+
+    lv_draw_buf_init(&tex.buf, w, h, LV_COLOR_FORMAT_RGB565, stride, tex.data, size);
+    return lv_snapshot_take_to_draw_buf(obj, LV_COLOR_FORMAT_RGB565, &tex.buf) == LV_RESULT_OK;
+}
+
+// Renders both textures on a throwaway screen that is never loaded.
+static bool render_static_layer(void)
+{
+    lv_obj_t * scratch = lv_obj_create(NULL);
+    lv_obj_clear_flag(scratch, LV_OBJ_FLAG_SCROLLABLE);
+    style_face_background(scratch);
+
+    create_face_track(scratch, 170);              // battery
+    create_face_track(scratch, SECOND_ARC_SIZE);  // seconds
+    create_face_track(scratch, 430);              // minutes
+    create_face_track(scratch, 410);              // hours
+    create_mid_ring(scratch, 260);
+    create_mid_ring(scratch, 300);
+    create_combined_scale(scratch);
+
+    bool ok = face_snapshot(scratch, staticFace);
+
+    // Seconds arc texture: the arc draws its image from the top-left of its own
+    // box, so render a SECOND_ARC_SIZE square with the full-size scale centred on it.
+    lv_obj_clean(scratch);
+    lv_obj_t * tile = lv_obj_create(scratch);
+    lv_obj_remove_style_all(tile);
+    lv_obj_set_size(tile, SECOND_ARC_SIZE, SECOND_ARC_SIZE);
+    lv_obj_center(tile);
+    lv_obj_set_style_bg_color(tile, lv_color_hex(SECOND_ARC_COLOR), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(tile, LV_OPA_COVER, LV_PART_MAIN);
+    create_combined_scale(tile);
+
+    ok = ok && face_snapshot(tile, secondArcTex);
+
+    lv_obj_delete(scratch);
+    return ok;
+}
+
 void ui_MainScreen_screen_init(void)
 {
     ui_MainScreen = lv_obj_create(NULL);
     lv_obj_clear_flag(ui_MainScreen, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
-    lv_obj_set_style_bg_color(ui_MainScreen, lv_color_hex(0x01070f), LV_PART_MAIN | LV_STATE_DEFAULT);
-    //lv_obj_set_style_bg_color(ui_MainScreen, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(ui_MainScreen, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_color(ui_MainScreen, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_main_stop(ui_MainScreen, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_grad_stop(ui_MainScreen, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    // Still styled so the screen looks right if the static layer can't be built;
+    // when it can, the opaque image covers it and LVGL skips the gradient.
+    style_face_background(ui_MainScreen);
+
+#if MAIN_STATIC_LAYER
+    staticLayerReady = render_static_layer();
+    if (staticLayerReady) {
+        ui_MainStaticLayer = lv_image_create(ui_MainScreen);
+        lv_image_set_src(ui_MainStaticLayer, &staticFace.buf);
+        lv_obj_center(ui_MainStaticLayer);
+        lv_obj_clear_flag(ui_MainStaticLayer, LV_OBJ_FLAG_CLICKABLE);
+    } else {
+        Serial.println("[MainScreen] static layer unavailable, drawing face live");
+    }
+#endif
     
       // Initialize the main arc menu with glow effect on the indicator
     ui_MainArcMenu = lv_arc_create(ui_MainScreen);
@@ -157,6 +298,7 @@ void ui_MainScreen_screen_init(void)
     lv_obj_set_style_arc_width(ui_BatteryArc, 5, LV_PART_INDICATOR);
     lv_obj_set_style_arc_color(ui_BatteryArc, lv_color_hex(0x01070f), LV_PART_MAIN);
     lv_obj_set_style_arc_color(ui_BatteryArc, lv_color_hex(0x00FF00), LV_PART_INDICATOR); // Green color
+    if (staticLayerReady) lv_obj_set_style_arc_opa(ui_BatteryArc, 0, LV_PART_MAIN); // track is in the static layer
 
     ui_BatteryLabel = lv_label_create(ui_MainScreen);
     lv_obj_set_style_text_font(ui_BatteryLabel, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
@@ -241,6 +383,10 @@ void ui_MainScreen_screen_init(void)
         lv_obj_clear_flag(second_arc, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_set_style_arc_rounded(second_arc, false, LV_PART_MAIN | LV_STATE_DEFAULT);
         lv_obj_set_style_arc_rounded(second_arc, false, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+        if (staticLayerReady) {
+            lv_obj_set_style_arc_opa(second_arc, 0, LV_PART_MAIN);
+            lv_obj_set_style_arc_image_src(second_arc, &secondArcTex.buf, LV_PART_INDICATOR);
+        }
 
         minute_arc = lv_arc_create(ui_MainScreen);
         lv_obj_set_size(minute_arc, 430, 430);
@@ -258,6 +404,7 @@ void ui_MainScreen_screen_init(void)
         lv_obj_clear_flag(minute_arc, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_set_style_arc_rounded(minute_arc, false, LV_PART_MAIN | LV_STATE_DEFAULT);
         lv_obj_set_style_arc_rounded(minute_arc, false, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+        if (staticLayerReady) lv_obj_set_style_arc_opa(minute_arc, 0, LV_PART_MAIN);
 
         hour_arc = lv_arc_create(ui_MainScreen);
         lv_obj_set_size(hour_arc, 410, 410);
@@ -275,48 +422,15 @@ void ui_MainScreen_screen_init(void)
         lv_obj_clear_flag(hour_arc, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_set_style_arc_rounded(hour_arc, false, LV_PART_MAIN | LV_STATE_DEFAULT);
         lv_obj_set_style_arc_rounded(hour_arc, false, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+        if (staticLayerReady) lv_obj_set_style_arc_opa(hour_arc, 0, LV_PART_MAIN);
 
         // --- Mid info ring (between outer clock scale and inner arcs) ---
         // Visual: a single subtle/dark blue circle.
         // Content: date around ~1-2 o'clock, digital time around ~10 o'clock.
-        ui_MidInfoRing = lv_arc_create(ui_MainScreen);
-        lv_obj_set_size(ui_MidInfoRing, 260, 260);
-        lv_obj_center(ui_MidInfoRing);
-        lv_arc_set_bg_angles(ui_MidInfoRing, 0, 360);
-        lv_arc_set_rotation(ui_MidInfoRing, 270);
-        lv_arc_set_value(ui_MidInfoRing, 0);
-        lv_obj_remove_style(ui_MidInfoRing, NULL, LV_PART_KNOB);
-        lv_obj_clear_flag(ui_MidInfoRing, LV_OBJ_FLAG_CLICKABLE);
-
-        // Ring line style
-        lv_obj_set_style_arc_width(ui_MidInfoRing, 2, LV_PART_MAIN);
-        lv_obj_set_style_arc_color(ui_MidInfoRing, lv_color_hex(0x103357), LV_PART_MAIN); // dark-ish blue
-        lv_obj_set_style_arc_opa(ui_MidInfoRing, 200, LV_PART_MAIN);
-
-        // Hide indicator completely
-        lv_obj_set_style_arc_width(ui_MidInfoRing, 0, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_opa(ui_MidInfoRing, 0, LV_PART_INDICATOR);
-
-
-          ui_MidInfoBoundary = lv_arc_create(ui_MainScreen);
-        lv_obj_set_size(ui_MidInfoBoundary, 300, 300);
-        lv_obj_center(ui_MidInfoBoundary);
-        lv_arc_set_bg_angles(ui_MidInfoBoundary, 0, 360);
-        lv_arc_set_rotation(ui_MidInfoBoundary, 270);
-        lv_arc_set_value(ui_MidInfoBoundary, 0);
-        lv_obj_remove_style(ui_MidInfoBoundary, NULL, LV_PART_KNOB);
-        lv_obj_clear_flag(ui_MidInfoBoundary, LV_OBJ_FLAG_CLICKABLE);
-
-        // Ring line style
-        lv_obj_set_style_arc_width(ui_MidInfoBoundary, 2, LV_PART_MAIN);
-        lv_obj_set_style_arc_color(ui_MidInfoBoundary, lv_color_hex(0x103357), LV_PART_MAIN); // dark-ish blue
-        lv_obj_set_style_arc_opa(ui_MidInfoBoundary, 200, LV_PART_MAIN);
-
-        // Hide indicator completely
-        lv_obj_set_style_arc_width(ui_MidInfoBoundary, 0, LV_PART_INDICATOR);
-        lv_obj_set_style_arc_opa(ui_MidInfoBoundary, 0, LV_PART_INDICATOR);
-
-    
+        if (!staticLayerReady) {
+            ui_MidInfoRing     = create_mid_ring(ui_MainScreen, 260);
+            ui_MidInfoBoundary = create_mid_ring(ui_MainScreen, 300);
+        }
 
      // --- Tide segments: 24 arc "cells" around the ring ---
     // We use 24 lv_arc objects, one per segment, with their own angle range.
@@ -463,7 +577,7 @@ void ui_MainScreen_screen_init(void)
       
 
 
-        create_combined_scale();
+        if (!staticLayerReady) create_combined_scale(ui_MainScreen);
         
         // Call update to set initial values
 
@@ -549,8 +663,8 @@ void create_segmented_ring(lv_obj_t * parent) {
 
 }
 
-void create_combined_scale(void) {
-    lv_obj_t * MainClockScale = lv_scale_create(ui_MainScreen);
+lv_obj_t * create_combined_scale(lv_obj_t * parent) {
+    lv_obj_t * MainClockScale = lv_scale_create(parent);
     lv_obj_clear_flag(MainClockScale, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_set_style_blend_mode(MainClockScale, LV_BLEND_MODE_MULTIPLY, LV_PART_ANY);
     // Set the size to cover the outer ring
@@ -595,7 +709,7 @@ void create_combined_scale(void) {
     // Adjust colors to match your arcs if needed
     // For example, use lv_color_hex(0x41C7FF) or other colors
 
-
+    return MainClockScale;
 }
 
 // --- Tide helpers -----------------------------------------------------------
@@ -1218,9 +1332,8 @@ void update_main_screen(void) {
 void ui_mainscreen_apply_weather(uint16_t id, const char* tempText)
 {
     if (ui_WeatherImage) {
-        const char* iconPath = getMeteoconIcon(id, true);
-        Serial.println("Icon path set in MainScreen UI");
-        lv_img_set_src(ui_WeatherImage, iconPath);
+        const bool night = weather_icon_code_is_night(WeatherGet().icon);
+        weather_icon_show(ui_WeatherImage, weather_icon_for(id, night));
 
       //  lv_color_t sci_fi_blue = lv_color_make(0, 200, 255);
       //  lv_obj_set_style_img_recolor(ui_WeatherImage, sci_fi_blue, LV_PART_MAIN);
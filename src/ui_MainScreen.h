@@ -6,7 +6,8 @@
 
 void ui_MainScreen_screen_init(void);
 void update_main_screen(void);
-void create_combined_scale(void);
+lv_obj_t * create_combined_scale(lv_obj_t * parent);
+
 void create_segmented_ring(lv_obj_t * parent);
 void ui_mainscreen_apply_weather(uint16_t id, const char* tempText);
 
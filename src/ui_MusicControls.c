@@ -167,3 +167,18 @@ void ui_MusicControls_screen_init(void)
     lv_obj_add_event_cb(ui_MusicVolume, ui_event_MusicVolume, LV_EVENT_ALL, NULL);
 
 }
+
+// The screen itself is deleted by ScreenCache; NULL screen variables
+void ui_MusicControls_screen_destroy(void)
+{
+    ui_MusicControls = NULL;
+    ui_MainArcMenuMusic = NULL;
+    ui_musicartwork = NULL;
+    ui_SongTitleLabel = NULL;
+    ui_ArtistLabel = NULL;
+    ui_MusicArc = NULL;
+    ui_playbutton = NULL;
+    ui_previousbutton = NULL;
+    ui_nextbutton = NULL;
+    ui_MusicVolume = NULL;
+}
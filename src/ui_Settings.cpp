@@ -6,6 +6,7 @@
 #include "ui_Settings.h"
 #include "DisplayManager.h"
 #include "SettingsManager.h"
+#include "RecycledList.h"
 //#include "mc_circular_keyboard.h"
 
 lv_obj_t * arc_segments[NUM_SEGMENTS];
@@ -23,6 +24,22 @@ bool doScreenBrightnessUpdate;
 
 static const char *keyboard_context = nullptr;
 
+// Row pools behind wifi_list / bt_device_list. Scans rebind these instead of
+// rebuilding the lists, and the selected name is copied out so callbacks never
+// hold a pointer into a row that's about to be reused.
+static RecycledList s_wifiRows;
+static RecycledList s_btRows;
+static char s_selectedSsid[RECYCLED_LIST_TEXT_LEN];
+static char s_selectedDevice[RECYCLED_LIST_TEXT_LEN];
+
+#define SETTINGS_LIST_W     200
+#define SETTINGS_LIST_H     96
+#define SETTINGS_LIST_ROW_H 32
+
+static void open_wifi_password(const char *ssid);
+static void open_saved_network(const char *ssid);
+static void open_device_actions(const char *device_name);
+
 
 
 
@@ -86,12 +103,12 @@ void show_wifi_settings(void) {
     lv_obj_align_to(switch_label, wifi_switch, LV_ALIGN_TOP_LEFT, 0, 40); */
 
     // Create list for Wi-Fi networks (both saved and scanned)
-    //lv_obj_t * wifi_list = lv_list_create(content_area);
-    wifi_list = lv_list_create(content_area);
-    lv_obj_set_size(wifi_list, lv_pct(90), lv_pct(40));
+    wifi_list = recycled_list_create(&s_wifiRows, content_area, SETTINGS_LIST_W, SETTINGS_LIST_H,
+                                     SETTINGS_LIST_ROW_H, LV_SYMBOL_WIFI, wifi_row_selected, NULL);
     lv_obj_align(wifi_list, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_pad_all(wifi_list, 5, 0);
-    lv_list_add_text(wifi_list, "Wi-Fi Networks");
+    recycled_list_clear(&s_wifiRows);
+    recycled_list_add(&s_wifiRows, "Wi-Fi Networks", 0, RECYCLED_ITEM_HEADER);
+    recycled_list_refresh(&s_wifiRows);
     if (wifi_list == nullptr) {
     Serial.println("Error in show_wifi_settings: Wi-Fi list is not initialized.");
     return;
@@ -166,6 +183,22 @@ void ui_Settings_screen_init(void)
      add_segment_buttons(); // Use this if you're creating buttons
 }
 
+// ScreenCache has deleted the screen (and everything on it, keyboards included).
+// The next build starts from the radial menu; values come from currentSettings.
+void ui_Settings_screen_destroy(void)
+{
+    ui_Settings = nullptr;
+    ui_SettingsRadialMenu = nullptr;
+    content_area = nullptr;
+    content_label = nullptr;
+    wifi_list = nullptr;
+    bt_device_list = nullptr;
+    action_container = nullptr;
+    password_kb = nullptr;
+    keyboard_context = nullptr;
+    for (int i = 0; i < NUM_SEGMENTS; i++) arc_segments[i] = nullptr;
+}
+
 void add_segment_buttons(void) {
     int angle_per_segment = 360 / NUM_SEGMENTS;
     const char * segment_symbols[NUM_SEGMENTS] = {LV_SYMBOL_WIFI, LV_SYMBOL_SETTINGS, LV_SYMBOL_HOME, LV_SYMBOL_BLUETOOTH, LV_SYMBOL_REFRESH, LV_SYMBOL_AUDIO};
@@ -421,7 +454,8 @@ void wifi_switch_event_cb(lv_event_t *e) {
         }
         else
         {
-            lv_obj_clean(wifi_list); // Clear the list
+            recycled_list_clear(&s_wifiRows);
+            recycled_list_refresh(&s_wifiRows);
         }
     }
 }
@@ -541,10 +575,14 @@ void pair_btn_event_cb(lv_event_t * e) {
 }
 
 
-// Event callback for selecting a Bluetooth device
-void device_select_event_cb(lv_event_t * e) {
-    lv_obj_t * btn = (lv_obj_t*)lv_event_get_target(e);
-    const char * device_name = lv_list_get_button_text(bt_device_list, btn);
+// Row tapped in bt_device_list
+void device_row_selected(RecycledList * list, const RecycledListItem * item) {
+    snprintf(s_selectedDevice, sizeof(s_selectedDevice), "%s", item->text);
+    open_device_actions(s_selectedDevice);
+}
+
+static void open_device_actions(const char * device_name) {
+    if (!device_name || !action_container) return;
     Serial.printf("Selected device: %s\n", device_name);
 
     // Show the action container with connect/pair/disconnect buttons
@@ -594,17 +632,15 @@ void show_bluetooth_settings(void) {
     lv_obj_align_to(switch_label, bt_switch, LV_ALIGN_OUT_RIGHT_MID, 10, 0);
 
     // Create list for available devices
-    bt_device_list = lv_list_create(content_area);
-    lv_obj_set_size(bt_device_list, lv_pct(90), lv_pct(40));
+    bt_device_list = recycled_list_create(&s_btRows, content_area, SETTINGS_LIST_W, SETTINGS_LIST_H,
+                                          SETTINGS_LIST_ROW_H, LV_SYMBOL_BLUETOOTH, device_row_selected, NULL);
     lv_obj_align(bt_device_list, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_pad_all(bt_device_list, 5, 0);
 
     // Add sample devices (this should be updated dynamically based on available devices)
-    lv_obj_t * list_btn = lv_list_add_btn(bt_device_list, LV_SYMBOL_BLUETOOTH, "Device 1");
-    lv_obj_add_event_cb(list_btn, device_select_event_cb, LV_EVENT_CLICKED, bt_device_list);
-
-    list_btn = lv_list_add_btn(bt_device_list, LV_SYMBOL_BLUETOOTH, "Device 2");
-    lv_obj_add_event_cb(list_btn, device_select_event_cb, LV_EVENT_CLICKED, bt_device_list);
+    recycled_list_clear(&s_btRows);
+    recycled_list_add(&s_btRows, "Device 1", 0, 0);
+    recycled_list_add(&s_btRows, "Device 2", 0, 0);
+    recycled_list_refresh(&s_btRows);
 
     // Container for actions (connect, disconnect, pair)
     action_container = lv_obj_create(content_area);
@@ -750,11 +786,18 @@ void cancel_btn_cb(lv_event_t *e) {
     lv_obj_clear_flag(ui_SettingsRadialMenu, LV_OBJ_FLAG_HIDDEN);
 }
 
-// WiFi network selection callback
-void wifi_network_selected_cb(lv_event_t * e)
+// Row tapped in wifi_list: scanned networks ask for a password, saved ones that
+// weren't in range get edit/remove
+void wifi_row_selected(RecycledList * list, const RecycledListItem * item)
 {
-    // 1) Get the SSID from event user data
-    const char * selected_ssid = (const char *)lv_event_get_user_data(e);
+    snprintf(s_selectedSsid, sizeof(s_selectedSsid), "%s", item->text);
+    if (item->flags & RECYCLED_ITEM_ABSENT) open_saved_network(s_selectedSsid);
+    else                                    open_wifi_password(s_selectedSsid);
+}
+
+static void open_wifi_password(const char * selected_ssid)
+{
+    // 1) The SSID (copied out of the row)
     if (!selected_ssid) {
         Serial.println("Error: No SSID provided.");
         return;
@@ -850,9 +893,8 @@ void wifi_network_selected_cb(lv_event_t * e)
 
 
 
-// Saved network selection callback
-void saved_network_selected_cb(lv_event_t *e) {
-    const char *selected_ssid = (const char *)lv_event_get_user_data(e);
+// Saved network that wasn't in range: offer edit/remove
+static void open_saved_network(const char *selected_ssid) {
     Serial.printf("Selected saved SSID: %s\n", selected_ssid);
 
     // Create an edit button to update password
@@ -979,54 +1021,65 @@ void connect_wifi_network_event_cb(lv_event_t * e) {
 }
 
 
+// Is this SSID among the current scan results?
+static bool scan_has_ssid(const String &ssid, int networkCount) {
+    for (int i = 0; i < networkCount; ++i) {
+        if (WiFi.SSID(i) == ssid) return true;
+    }
+    return false;
+}
+
 // Display WiFi networks (saved and scanned)
 void scan_and_display_wifi_networks() {
     if (wifi_list == nullptr) {
         Serial.println("Error in scan & display networks: Wi-Fi list is not initialized.");
-       // return;
+        return;
     }
     wifi_enable();
-    lv_obj_clean(wifi_list); // Clear previous content
-    lv_list_add_text(wifi_list, "Networks Discovered");
+    recycled_list_clear(&s_wifiRows);
+    recycled_list_add(&s_wifiRows, "Networks Discovered", 0, RECYCLED_ITEM_HEADER);
     int networkCount = WiFi.scanNetworks();
+    if (networkCount < 0) networkCount = 0;
+
+    // Saved networks out of range get a row each; checked against the scan
+    // itself, so a long scan can't push an in-range one into this group
+    const auto &savedNetworks = currentSettings.known_wifi_networks;
+    size_t absentCount = 0;
+    for (const auto &savedNetwork : savedNetworks) {
+        if (!scan_has_ssid(savedNetwork.ssid, networkCount)) absentCount++;
+    }
+
     if (networkCount == 0) {
-        lv_obj_t *list_btn = lv_list_add_btn(wifi_list, NULL, "No networks found");
-        lv_obj_add_state(list_btn, LV_STATE_DISABLED);
-    } else {
-        std::vector<String> savedSSIDs;
-
-        // Display scanned networks and identify saved networks
-        for (int i = 0; i < networkCount; ++i) {
-            const char *ssid = WiFi.SSID(i).c_str();
-            bool isSaved = false;
-
-            for (const auto &savedNetwork : currentSettings.known_wifi_networks) {
-                if (savedNetwork.ssid == ssid) {
-                    isSaved = true;
-                    savedSSIDs.push_back(savedNetwork.ssid);
-                    break;
-                }
-            }
+        recycled_list_add(&s_wifiRows, "No networks found", 0, RECYCLED_ITEM_HEADER);
+    }
 
-            // Create a list item for each network
-            lv_obj_t *list_btn = lv_list_add_button(wifi_list, NULL, ssid);
-            lv_obj_add_event_cb(list_btn, wifi_network_selected_cb, LV_EVENT_CLICKED, (void *)ssid);
+    // Scanned networks, leaving room for the absent saved ones
+    for (int i = 0; i < networkCount; ++i) {
+        if (s_wifiRows.count + absentCount >= RECYCLED_LIST_MAX_ITEMS) break;
 
-            // If the network is saved, mark it with a different color
-            if (isSaved) {
-                lv_obj_set_style_text_color(list_btn, lv_color_hex(0x41C7FF), 0); // Set a specific color
+        String ssid = WiFi.SSID(i);
+        uint8_t flags = 0;
+
+        for (const auto &savedNetwork : savedNetworks) {
+            if (savedNetwork.ssid == ssid) {
+                flags |= RECYCLED_ITEM_SAVED;
+                break;
             }
         }
+        if (WiFi.encryptionType(i) != WIFI_AUTH_OPEN) flags |= RECYCLED_ITEM_LOCKED;
 
-        // Display saved networks that weren't found in the current scan
-        for (const auto &savedNetwork : currentSettings.known_wifi_networks) {
-            if (std::find(savedSSIDs.begin(), savedSSIDs.end(), savedNetwork.ssid) == savedSSIDs.end()) {
-                lv_obj_t *list_btn = lv_list_add_btn(wifi_list, NULL, savedNetwork.ssid.c_str());
-                lv_obj_add_event_cb(list_btn, saved_network_selected_cb, LV_EVENT_CLICKED, (void *)savedNetwork.ssid.c_str());
-                lv_obj_set_style_text_color(list_btn, lv_color_hex(0xAAAAAA), 0); // Greyed out to indicate it's not found
-            }
+        int32_t rssi = WiFi.RSSI(i);
+        if (rssi < INT8_MIN) rssi = INT8_MIN;
+        recycled_list_add(&s_wifiRows, ssid.c_str(), (int8_t)rssi, flags);
+    }
+
+    // Saved networks that weren't found in the current scan, greyed out
+    for (const auto &savedNetwork : savedNetworks) {
+        if (!scan_has_ssid(savedNetwork.ssid, networkCount)) {
+            recycled_list_add(&s_wifiRows, savedNetwork.ssid.c_str(), 0, RECYCLED_ITEM_ABSENT);
         }
     }
 
     WiFi.scanDelete();
-}
\ No newline at end of file
+    recycled_list_refresh(&s_wifiRows);
+}
@@ -8,6 +8,7 @@
 #include "ui.h"
 //#include "PowerManager.h"
 #include "SettingsManager.h"
+#include "RecycledList.h"
 
 // Number of menu items
 #define NUM_SEGMENTS 6
@@ -24,6 +25,7 @@ extern lv_obj_t * content_area;
 
 // Function prototypes
 void ui_Settings_screen_init(void);
+void ui_Settings_screen_destroy(void);
 void create_radial_menu(void);
 void create_content_area(void);
 void arc_event_cb(lv_event_t * e);
@@ -45,8 +47,6 @@ void brightness_slider_event_cb(lv_event_t * e);
 void brightness_slider_released_event_cb(lv_event_t * e);
 void sleep_timer_slider_event_cb(lv_event_t * e);
 void wifi_switch_event_cb(lv_event_t * e);
-void wifi_network_selected_cb(lv_event_t * e);
-void saved_network_selected_cb(lv_event_t * e);
 void save_wifi_network_event_cb(lv_event_t * e);
 void edit_saved_network_event_cb(lv_event_t * e);
 void remove_saved_network_event_cb(lv_event_t * e);
@@ -54,6 +54,8 @@ void connect_wifi_network_event_cb(lv_event_t * e);
 void settingsMenu_valuechange(lv_event_t * e);
 void settingsMenu_select(lv_event_t * e);
 void save_updated_password_event_cb(lv_event_t * e);
+void wifi_row_selected(RecycledList * list, const RecycledListItem * item);
+void device_row_selected(RecycledList * list, const RecycledListItem * item);
 
 void wifi_enable(void);
 void wifi_disable(void);
@@ -95,9 +95,10 @@ void mainarc_select(lv_event_t * e)
         _ui_screen_change(&ui_ClockScreen, LV_SCR_LOAD_ANIM_FADE_ON, 200, 50, ui_ClockScreen_screen_init);
     } else if(arcvalue >= 200 && arcvalue < 300) {
         // Third section (200-300) - Change to Music Controls
+        _ui_screen_change(&ui_MusicControls, LV_SCR_LOAD_ANIM_FADE_ON, 100, 0, ui_MusicControls_screen_init);
+        // Music may have been evicted; it exists again after the change
         lv_arc_set_start_angle(ui_MainArcMenuMusic, 240);
          lv_arc_set_end_angle(ui_MainArcMenuMusic, 300);
-        _ui_screen_change(&ui_MusicControls, LV_SCR_LOAD_ANIM_FADE_ON, 100, 0, ui_MusicControls_screen_init);
     } else if(arcvalue >= 300 && arcvalue < 400) {
         // Fourth section (300-400) - Change to Settings
          lv_arc_set_start_angle(ui_MainArcSettingsMenu, 300);
@@ -172,9 +173,9 @@ void mainarcclock_select(lv_event_t * e)
         return;
     } else if(arcvalue >= 200 && arcvalue < 300) {
         // Third section (200-300) - Change to Music Controls
+        _ui_screen_change(&ui_MusicControls, LV_SCR_LOAD_ANIM_FADE_ON, 200, 50, ui_MusicControls_screen_init);
         lv_arc_set_start_angle(ui_MainArcMenuMusic, 240);
          lv_arc_set_end_angle(ui_MainArcMenuMusic, 300);
-        _ui_screen_change(&ui_MusicControls, LV_SCR_LOAD_ANIM_FADE_ON, 200, 50, ui_MusicControls_screen_init);
     } else if(arcvalue >= 300 && arcvalue < 400) {
         // Fourth section (300-400) - Change to Settings
      //    lv_arc_set_start_angle(ui_MainArcSettingsMenu, 300);
@@ -342,9 +343,9 @@ void mainarcsettings_select(lv_event_t * e)
         _ui_screen_change(&ui_ClockScreen, LV_SCR_LOAD_ANIM_FADE_ON, 100, 0, ui_ClockScreen_screen_init);
     } else if(arcvalue >= 200 && arcvalue < 300) {
         // Third section (200-300) - Change to Music Controls
+        _ui_screen_change(&ui_MusicControls, LV_SCR_LOAD_ANIM_FADE_ON, 100, 0, ui_MusicControls_screen_init);
         lv_arc_set_start_angle(ui_MainArcMenuMusic, 240);
          lv_arc_set_end_angle(ui_MainArcMenuMusic, 300);
-        _ui_screen_change(&ui_MusicControls, LV_SCR_LOAD_ANIM_FADE_ON, 100, 0, ui_MusicControls_screen_init);
     } else if(arcvalue >= 300 && arcvalue < 400) {
         // Fourth section (300-400) - Change to Settings
         return;
@@ -4,6 +4,7 @@
 // Project name: SmartWatch
 
 #include "ui_helpers.h"
+#include "ScreenCache.h"
 
 void _ui_bar_set_property(lv_obj_t * target, int id, int val)
 {
@@ -51,16 +52,14 @@ void _ui_slider_set_property(lv_obj_t * target, int id, int val)
 
 void _ui_screen_change(lv_obj_t ** target, lv_scr_load_anim_t fademode, int spd, int delay, void (*target_init)(void))
 {
-    if(*target == NULL)
-        target_init();
+    screen_cache_ensure(target, target_init);   // builds it if never built or evicted
     lv_scr_load_anim(*target, fademode, spd, delay, false);
 }
 
 void _ui_screen_delete(lv_obj_t ** target)
 {
-    if(*target == NULL) {
-        lv_obj_del(*target);
-        target = NULL;
+    if(*target != NULL) {
+        screen_cache_evict(target);   // runs the screen's destroy hook, NULLs *target
     }
 }
 